@@ -5,6 +5,10 @@
  * Version: 1.0.0
  */
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -12,6 +16,20 @@
 #include <stdbool.h>
 #include <time.h>
 #include <math.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <errno.h>
+#include <fnmatch.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 /* ============================================================================
  * CONSTANTS AND MACROS
@@ -25,6 +43,65 @@
 #define GOON_MAX_STACK_SIZE 512
 #define GOON_CACHE_SIZE 64
 #define GOON_POOL_SIZE 128
+#define GOON_POOL_MIN_SHIFT 4
+#define GOON_POOL_CLASSES 13
+#define GOON_POOL_MAGAZINE_SIZE 32
+#define GOON_POOL_CACHE_WAYS 4
+#define GOON_POOL_MAGIC 0x4c4f4f50u
+#define GOON_POOL_MAGIC_FREE 0x45455246u
+#define GOON_CACHE_LINE 64
+#define GOON_PRIORITY_COUNT 4
+#define GOON_LANE_AGING_LIMIT 64
+#define GOON_DISPATCH_BATCH 64
+#define GOON_MAX_CHAINS 64
+#define GOON_MAX_HANDLER_DEPS 8
+#define GOON_HIST_SUB_BITS 4
+#define GOON_HIST_SUB_COUNT (1 << GOON_HIST_SUB_BITS)
+#define GOON_HIST_MAX_BITS 40
+#define GOON_HIST_BUCKETS ((GOON_HIST_MAX_BITS - GOON_HIST_SUB_BITS + 1) * GOON_HIST_SUB_COUNT)
+#define GOON_TIMING_SAMPLE_RATE 16
+
+// Build with -DGOON_DISABLE_TIMING to compile handler timing out entirely
+#ifdef GOON_DISABLE_TIMING
+#define GOON_TIMING_COMPILED 0
+#else
+#define GOON_TIMING_COMPILED 1
+#endif
+#define GOON_SEGMENT_BYTES 4096
+#define GOON_SEGMENT_EVENTS ((GOON_SEGMENT_BYTES - sizeof(void*)) / sizeof(void*))
+#define GOON_SEGMENT_FREE_MAX 16
+#define GOON_WHEEL_LEVELS 4
+#define GOON_WHEEL_BITS 8
+#define GOON_WHEEL_SLOTS (1 << GOON_WHEEL_BITS)
+#define GOON_WHEEL_MASK (GOON_WHEEL_SLOTS - 1)
+#define GOON_TIMER_NIL UINT32_MAX
+#define GOON_COALESCE_INITIAL_SIZE 64
+#define GOON_COALESCE_EMPTY 0
+#define GOON_COALESCE_LIVE 1
+#define GOON_COALESCE_TOMBSTONE 2
+#define GOON_SYMBOL_NONE 0
+#define GOON_SYMBOL_CHUNK_BITS 10
+#define GOON_SYMBOL_CHUNK (1u << GOON_SYMBOL_CHUNK_BITS)
+#define GOON_SYMBOL_CHUNKS 4096
+#define GOON_SYMBOL_INDEX_INITIAL 1024
+#define GOON_ROUTE_TABLE_INITIAL 64
+#define GOON_ROUTE_SLOT_NONE UINT32_MAX
+#define GOON_WORKER_CHUNK 16
+#define GOON_WORKER_INTAKE 256
+#define GOON_WORKER_DEQUE_SIZE 256
+#define GOON_WORKER_PARK_MS 100
+#define GOON_WORKER_MAX_FDS 16
+#define GOON_WORKER_POLL_EVENTS 16
+#define GOON_DATA_INLINE_SIZE 32
+#define GOON_ARENA_BLOCK_SIZE (64u * 1024u)
+#define GOON_ARENA_KEEP_BLOCKS 16
+#define GOON_SLAB_CHUNK_SLOTS 512
+#define GOON_SLAB_MAGAZINE_SIZE 64
+#define GOON_SLAB_CACHE_WAYS 8
+#define GOON_DISK_SEGMENT_SIZE (4u * 1024u * 1024u)
+#define GOON_DISK_FREE_SEGMENTS 4
+#define GOON_DISK_MAGIC 0x31474553474f4f47ULL
+#define GOON_DISK_MAGIC_FREE 0x45455246474f4f47ULL
 
 #define GOON_SUCCESS 0
 #define GOON_ERROR -1
@@ -34,6 +111,18 @@
 #define GOON_ERROR_NOT_FOUND -5
 #define GOON_ERROR_OVERFLOW -6
 #define GOON_ERROR_UNDERFLOW -7
+#define GOON_ERROR_TIMEOUT -8
+
+// Handler verdicts; GOON_SUCCESS continues with the next handler
+#define GOON_CONTINUE GOON_SUCCESS
+#define GOON_DROP 1
+#define GOON_STOP_CHAIN 2
+#define GOON_PENDING 3
+
+#define GOON_ASYNC_WAITING 0
+#define GOON_ASYNC_QUEUED 1
+#define GOON_ASYNC_RUNNING 2
+#define GOON_ASYNC_RESUMED 3
 
 #define GOON_LOG(level, ...) goon_log(level, __FILE__, __LINE__, __VA_ARGS__)
 #define GOON_DEBUG(...) GOON_LOG(GOON_LOG_DEBUG, __VA_ARGS__)
@@ -71,6 +160,55 @@ typedef enum {
     GOON_TYPE_CUSTOM
 } goon_data_type_t;
 
+// Who owns a payload's bytes: see goon_data_create_owned()
+typedef enum {
+    GOON_DATA_COPY,
+    GOON_DATA_MOVE,
+    GOON_DATA_BORROW,
+    GOON_DATA_SHARED,
+    GOON_DATA_ARENA,
+    GOON_DATA_POOL
+} goon_data_mode_t;
+
+typedef enum {
+    GOON_QUEUE_MODE_LIST,
+    GOON_QUEUE_MODE_RING,
+    GOON_QUEUE_MODE_LANES,
+    GOON_QUEUE_MODE_SEGMENTED
+} goon_queue_mode_t;
+
+typedef enum {
+    GOON_DRAIN_FIFO,
+    GOON_DRAIN_STRICT,
+    GOON_DRAIN_WEIGHTED
+} goon_drain_policy_t;
+
+typedef enum {
+    GOON_COALESCE_OFF,
+    GOON_COALESCE_REPLACE,
+    GOON_COALESCE_MERGE
+} goon_coalesce_mode_t;
+
+typedef enum {
+    GOON_OVERFLOW_REJECT,
+    GOON_OVERFLOW_BLOCK,
+    GOON_OVERFLOW_DROP_OLDEST,
+    GOON_OVERFLOW_DROP_LOWEST,
+    GOON_OVERFLOW_SPILL
+} goon_overflow_policy_t;
+
+typedef enum {
+    GOON_TIMING_OFF,
+    GOON_TIMING_SAMPLED
+} goon_timing_mode_t;
+
+typedef enum {
+    GOON_MATCH_ALL,
+    GOON_MATCH_EXACT,
+    GOON_MATCH_PREFIX,
+    GOON_MATCH_GLOB
+} goon_match_kind_t;
+
 typedef enum {
     GOON_PRIORITY_LOW,
     GOON_PRIORITY_NORMAL,
@@ -82,50 +220,183 @@ typedef struct goon_context goon_context_t;
 typedef struct goon_handler goon_handler_t;
 typedef struct goon_event goon_event_t;
 typedef struct goon_data goon_data_t;
+typedef struct goon_shared goon_shared_t;
 typedef struct goon_queue goon_queue_t;
 typedef struct goon_stack goon_stack_t;
 typedef struct goon_cache goon_cache_t;
 typedef struct goon_pool goon_pool_t;
+typedef struct goon_timer_wheel goon_timer_wheel_t;
+typedef struct goon_async goon_async_t;
+typedef struct goon_disk_queue goon_disk_queue_t;
+typedef struct goon_event_slab goon_event_slab_t;
+typedef struct goon_arena goon_arena_t;
+typedef uint64_t goon_timer_id_t;
+typedef uint32_t goon_symbol_t;
 
 typedef int (*goon_handler_func)(goon_context_t *ctx, goon_event_t *event, void *user_data);
 typedef void (*goon_cleanup_func)(void *data);
+typedef int (*goon_merge_func)(goon_event_t *queued, goon_event_t *incoming, void *user_data);
 typedef void* (*goon_alloc_func)(size_t size);
+typedef void (*goon_fd_func)(goon_context_t *ctx, int fd, uint32_t events, void *user_data);
 typedef void (*goon_free_func)(void *ptr);
 
 struct goon_data {
     goon_data_type_t type;
+    goon_data_mode_t mode;
+    size_t size;
+    void *value;
+    goon_cleanup_func cleanup;
+    union {
+        // Copied payloads that fit live here; `value` then points at it
+        _Alignas(max_align_t) unsigned char inline_value[GOON_DATA_INLINE_SIZE];
+        goon_shared_t *shared;
+    };
+};
+
+struct goon_shared {
+    _Atomic uint32_t refs;
     size_t size;
     void *value;
     goon_cleanup_func cleanup;
 };
 
+/*
+ * An event fits one cache line, and every allocator hands them out
+ * line-aligned. The first 32 bytes hold what queues and dispatch read;
+ * linkage, user_data and allocation bookkeeping follow. The name lives
+ * in the symbol table. Code outside the queues should go through the
+ * goon_event_get_* accessors.
+ */
 struct goon_event {
     uint32_t id;
-    char name[GOON_MAX_NAME_LEN];
-    goon_priority_t priority;
-    time_t timestamp;
+    goon_symbol_t sym;
+    uint8_t priority;
+    bool in_arena;
+    uint16_t reserved;
+    _Atomic uint32_t coalesce_slot;
+    uint64_t timestamp_ns;
     goon_data_t *data;
-    void *user_data;
+    
     struct goon_event *next;
+    void *user_data;
+    goon_event_slab_t *slab;
+};
+
+_Static_assert(sizeof(goon_event_t) <= GOON_CACHE_LINE, "goon_event_t must fit one cache line");
+
+typedef struct goon_arena_block {
+    goon_arena_t *arena;
+    struct goon_arena_block *next;
+} goon_arena_block_t;
+
+struct goon_arena {
+    goon_arena_block_t *head;
+    goon_arena_block_t *current;
+    size_t offset;
+    size_t block_count;
+    uint64_t allocs;
+    uint64_t resets;
+    _Atomic size_t live;
 };
 
+typedef struct {
+    bool enabled;
+    size_t blocks;
+    size_t bytes;
+    size_t live;
+    uint64_t allocs;
+    uint64_t resets;
+} goon_arena_stats_t;
+
+typedef struct {
+    _Atomic uint64_t counts[GOON_HIST_BUCKETS];
+    _Atomic uint64_t total;
+    _Atomic uint64_t sum_ns;
+    _Atomic uint64_t max_ns;
+} goon_histogram_t;
+
 struct goon_handler {
     uint32_t id;
     char name[GOON_MAX_NAME_LEN];
     goon_handler_func func;
     void *user_data;
     bool enabled;
-    uint64_t call_count;
-    uint64_t error_count;
-    double avg_exec_time;
+    _Atomic uint64_t call_count;
+    _Atomic uint64_t error_count;
+    _Atomic(goon_histogram_t*) latency;
+    goon_match_kind_t match_kind;
+    char pattern[GOON_MAX_NAME_LEN];
+    uint64_t route_rank;
+    uint32_t route_slot;
+    int order;
+    uint8_t chain;
+    _Atomic uint64_t drop_count;
+    goon_symbol_t name_sym;
+    goon_symbol_t after[GOON_MAX_HANDLER_DEPS];
+    size_t after_count;
+    bool mutates;
     struct goon_handler *next;
 };
 
+struct goon_async {
+    goon_context_t *ctx;
+    goon_event_t *event;
+    goon_handler_func resume;
+    void *state;
+    goon_symbol_t handler_sym;
+    int order;
+    uint64_t route_rank;
+    uint8_t chain;
+    uint64_t stopped;
+    _Atomic int status;
+    struct goon_async *next;
+};
+
+typedef struct {
+    _Atomic size_t sequence;
+    goon_event_t *event;
+} goon_ring_slot_t;
+
+typedef struct goon_segment {
+    struct goon_segment *next;
+    goon_event_t *events[GOON_SEGMENT_EVENTS];
+} goon_segment_t;
+
 struct goon_queue {
+    goon_queue_mode_t mode;
     goon_event_t *head;
     goon_event_t *tail;
     size_t size;
     size_t max_size;
+    
+    // Ring mode: bounded MPMC array with per-slot sequence numbers
+    goon_ring_slot_t *slots;
+    size_t mask;
+    char pad0[GOON_CACHE_LINE];
+    _Atomic size_t enqueue_pos;
+    char pad1[GOON_CACHE_LINE - sizeof(size_t)];
+    _Atomic size_t dequeue_pos;
+    char pad2[GOON_CACHE_LINE - sizeof(size_t)];
+    
+    // Lanes mode: one sub-queue per priority, drained by policy
+    goon_queue_t *lanes[GOON_PRIORITY_COUNT];
+    _Atomic size_t lane_count;
+    goon_drain_policy_t drain_policy;
+    uint32_t lane_weights[GOON_PRIORITY_COUNT];
+    // Ring-backed lanes can have several consumers updating these at once
+    _Atomic uint32_t lane_credits[GOON_PRIORITY_COUNT];
+    _Atomic uint32_t lane_skips[GOON_PRIORITY_COUNT];
+    uint32_t aging_limit;
+    
+    // Segmented mode: unbounded chain of 4 KiB pointer segments
+    goon_segment_t *seg_head;
+    goon_segment_t *seg_tail;
+    size_t seg_read;
+    size_t seg_write;
+    goon_segment_t *seg_free;
+    size_t seg_free_count;
+    size_t seg_allocated;
+    size_t memory_limit;
 };
 
 struct goon_stack {
@@ -142,30 +413,383 @@ struct goon_cache {
     size_t count;
 };
 
+// Precedes every pooled object; 16 bytes keeps the object max-aligned
+typedef struct goon_pool_block {
+    union {
+        struct goon_pool_block *next;
+        goon_pool_t *pool;
+    };
+    uint32_t size_class;
+    uint32_t magic;
+} goon_pool_block_t;
+
+typedef struct goon_pool_magazine {
+    struct goon_pool_magazine *next;
+    uint32_t count;
+    goon_pool_block_t *blocks[GOON_POOL_MAGAZINE_SIZE];
+} goon_pool_magazine_t;
+
+typedef struct {
+    pthread_mutex_t lock;
+    goon_pool_block_t *free_list;
+    size_t free_count;
+    goon_pool_magazine_t *full;
+    goon_pool_magazine_t *empty;
+    size_t depot_count;
+    size_t allocated;
+    size_t magazines;
+    uint64_t misses;
+    uint64_t depot_gets;
+    uint64_t depot_puts;
+    uint64_t contended;
+} goon_pool_class_t;
+
 struct goon_pool {
-    void **objects;
-    bool *in_use;
-    size_t size;
+    goon_pool_class_t classes[GOON_POOL_CLASSES];
     size_t capacity;
+    _Atomic size_t oversize;
+    _Atomic uint32_t refs;
     goon_alloc_func alloc;
     goon_free_func free;
 };
 
+typedef struct {
+    goon_pool_t *pool;
+    goon_pool_magazine_t *loaded[GOON_POOL_CLASSES];
+    goon_pool_magazine_t *previous[GOON_POOL_CLASSES];
+} goon_pool_cache_t;
+
+typedef struct {
+    size_t in_use[GOON_POOL_CLASSES];
+    size_t free[GOON_POOL_CLASSES];
+    size_t total_in_use;
+    size_t oversize;
+    size_t cached_bytes;
+    size_t magazines;
+    uint64_t misses;
+    uint64_t depot_gets;
+    uint64_t depot_puts;
+    uint64_t contended;
+} goon_pool_stats_t;
+
+typedef struct {
+    uint64_t expires;
+    uint64_t interval;
+    uint64_t sequence;
+    goon_event_t *event;
+    uint32_t next;
+    uint32_t prev;
+    uint32_t generation;
+    uint16_t level;
+    uint16_t slot;
+    bool active;
+} goon_timer_t;
+
+struct goon_timer_wheel {
+    goon_timer_t *timers;
+    uint32_t capacity;
+    uint32_t free_head;
+    uint32_t slots[GOON_WHEEL_LEVELS][GOON_WHEEL_SLOTS];
+    uint32_t tails[GOON_WHEEL_LEVELS][GOON_WHEEL_SLOTS];
+    size_t level_count[GOON_WHEEL_LEVELS];
+    size_t active;
+    uint64_t current;
+    uint64_t origin_ms;
+    uint64_t next_sequence;
+    pthread_mutex_t lock;
+};
+
+typedef struct {
+    uint64_t hash;
+    goon_event_t *event;
+    uint8_t state;
+    char key[GOON_MAX_NAME_LEN];
+} goon_coalesce_entry_t;
+
+typedef struct {
+    goon_coalesce_entry_t *entries;
+    size_t capacity;
+    size_t live;
+    size_t tombstones;
+} goon_coalesce_index_t;
+
+typedef struct {
+    char *name;
+    uint64_t hash;
+    size_t length;
+} goon_symbol_entry_t;
+
+typedef struct {
+    goon_symbol_entry_t *chunks[GOON_SYMBOL_CHUNKS];
+    goon_symbol_t *index;
+    size_t index_capacity;
+    _Atomic uint32_t count;
+    pthread_rwlock_t lock;
+} goon_symbol_table_t;
+
+typedef struct {
+    goon_handler_t **items;
+    size_t count;
+    size_t capacity;
+} goon_route_list_t;
+
+typedef struct goon_route_entry {
+    uint64_t hash;
+    char *name;
+    goon_route_list_t handlers;
+    struct goon_route_entry *next;
+} goon_route_entry_t;
+
+typedef struct {
+    goon_route_entry_t **buckets;
+    size_t bucket_count;
+    size_t count;
+} goon_route_table_t;
+
+typedef struct goon_route_node {
+    unsigned char key;
+    struct goon_route_node *child;
+    struct goon_route_node *sibling;
+    goon_route_list_t handlers;
+} goon_route_node_t;
+
+typedef struct {
+    goon_handler_func func;
+    void *user_data;
+    goon_handler_t *handler;
+} goon_dispatch_entry_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t slots[];
+} goon_route_t;
+
+typedef struct {
+    goon_dispatch_entry_t *entries;
+    size_t entry_count;
+    _Atomic(goon_route_t*) *routes;
+    size_t route_capacity;
+    _Atomic size_t route_count;
+    uint64_t version;
+} goon_dispatch_table_t;
+
+typedef struct {
+    goon_route_table_t exact;
+    goon_route_node_t prefixes;
+    goon_route_list_t globs;
+    goon_route_list_t wildcard;
+    goon_route_list_t handlers;
+    size_t subscriptions[4];
+    _Atomic(goon_dispatch_table_t*) table;
+    uint64_t version;
+    uint64_t route_misses;
+    pthread_mutex_t lock;
+} goon_router_t;
+
+typedef struct goon_rcu_reader {
+    _Atomic uint64_t epoch;
+    _Atomic bool in_use;
+    uint32_t depth;
+    struct goon_rcu_reader *next;
+} goon_rcu_reader_t;
+
+typedef struct goon_rcu_retired {
+    void *ptr;
+    goon_free_func free;
+    uint64_t epoch;
+    struct goon_rcu_retired *next;
+} goon_rcu_retired_t;
+
+typedef struct {
+    _Atomic uint64_t epoch;
+    _Atomic(goon_rcu_reader_t*) readers;
+    _Atomic uint32_t anonymous;
+    goon_rcu_retired_t *retired;
+    _Atomic size_t retired_count;
+    pthread_mutex_t lock;
+    pthread_once_t once;
+    pthread_key_t key;
+} goon_rcu_domain_t;
+
+typedef struct goon_slab_magazine {
+    struct goon_slab_magazine *next;
+    uint32_t count;
+    void *slots[GOON_SLAB_MAGAZINE_SIZE];
+} goon_slab_magazine_t;
+
+typedef struct goon_slab_chunk {
+    struct goon_slab_chunk *next;
+} goon_slab_chunk_t;
+
+struct goon_event_slab {
+    size_t slot_size;
+    pthread_mutex_t lock;
+    goon_slab_chunk_t *chunks;
+    uint8_t *carve;
+    size_t carve_left;
+    goon_slab_magazine_t *full;
+    goon_slab_magazine_t *empty;
+    void *loose;
+    size_t chunk_count;
+    size_t capacity;
+    size_t depot_free;
+    size_t magazine_count;
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t exchanges;
+    _Atomic uint32_t refs;
+};
+
+typedef struct {
+    goon_event_slab_t *slab;
+    goon_slab_magazine_t *loaded;
+    goon_slab_magazine_t *previous;
+    uint64_t allocs;
+    uint64_t frees;
+} goon_slab_cache_t;
+
+typedef struct {
+    size_t slot_size;
+    size_t chunks;
+    size_t capacity;
+    size_t depot_free;
+    size_t outstanding;
+    size_t magazines;
+    size_t bytes;
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t exchanges;
+} goon_slab_stats_t;
+
+typedef struct {
+    uint64_t magic;
+    uint64_t sequence;
+    uint64_t read_offset;
+    uint64_t reserved;
+} goon_disk_header_t;
+
+typedef struct {
+    uint32_t length;
+    uint32_t checksum;
+    uint32_t tag;
+    uint32_t id;
+    int32_t priority;
+    int32_t data_type;
+    int64_t timestamp;
+    uint64_t instance;
+    uint64_t user_data;
+    uint64_t data_ptr;
+    uint64_t data_size;
+    uint32_t name_len;
+    uint32_t reserved;
+} goon_disk_record_t;
+
+typedef struct goon_disk_segment {
+    uint64_t sequence;
+    uint8_t *map;
+    size_t size;
+    size_t end;
+    struct goon_disk_segment *next;
+} goon_disk_segment_t;
+
+struct goon_disk_queue {
+    char dir[GOON_BUFFER_SIZE];
+    size_t segment_size;
+    goon_disk_segment_t *head;
+    goon_disk_segment_t *tail;
+    goon_disk_segment_t *read_seg;
+    size_t read_offset;
+    goon_disk_segment_t *free_list;
+    size_t free_count;
+    uint64_t next_sequence;
+    size_t pending;
+    uint64_t appended;
+    uint64_t recycled;
+};
+
+typedef struct {
+    uint64_t rejected;
+    uint64_t blocked;
+    uint64_t timed_out;
+    uint64_t dropped_oldest;
+    uint64_t dropped_lowest;
+    uint64_t spilled;
+    uint64_t unspilled;
+    uint64_t spill_high_water;
+} goon_backpressure_stats_t;
+
 struct goon_context {
     uint32_t id;
     char name[GOON_MAX_NAME_LEN];
-    goon_state_t state;
+    _Atomic goon_state_t state;
     goon_handler_t *handlers;
     size_t handler_count;
+    goon_router_t *router;
+    uint64_t next_route_rank;
+    goon_symbol_t chains[GOON_MAX_CHAINS];
+    size_t chain_count;
+    bool fanout;
+    goon_timing_mode_t timing_mode;
+    uint32_t timing_sample_rate;
     goon_queue_t *event_queue;
     goon_stack_t *call_stack;
     goon_cache_t *cache;
     goon_pool_t *memory_pool;
-    uint64_t event_count;
-    uint64_t total_events_processed;
+    goon_event_slab_t *event_slab;
+    bool arena_mode;
+    goon_arena_t arenas[2];
+    uint32_t arena_active;
+    pthread_mutex_t arena_lock;
+    goon_queue_mode_t queue_mode;
+    goon_drain_policy_t drain_policy;
+    size_t queue_capacity;
+    size_t queue_memory_limit;
+    goon_timer_wheel_t *timers;
+    goon_coalesce_mode_t coalesce_mode;
+    goon_merge_func merge_func;
+    void *merge_user_data;
+    goon_coalesce_index_t *coalesce_index;
+    pthread_mutex_t coalesce_lock;
+    _Atomic uint64_t coalesced_count;
+    _Atomic uint64_t event_count;
+    _Atomic uint64_t total_events_processed;
     time_t start_time;
     void *user_data;
     bool debug_mode;
+    
+    // Suspended handlers: resumed tokens wait here for a dispatching thread
+    pthread_mutex_t async_lock;
+    goon_async_t *async_head;
+    goon_async_t *async_tail;
+    _Atomic size_t async_ready;
+    _Atomic size_t async_suspended;
+    
+    // Signalled when work arrives for a consumer blocked in goon_worker_run
+    int wake_fd;
+    _Atomic bool wake_pending;
+    
+    // Backpressure: blocked producers wait on space_cond, overflow can spill
+    goon_overflow_policy_t overflow_policy;
+    long overflow_timeout_ms;
+    pthread_mutex_t space_lock;
+    pthread_cond_t space_cond;
+    _Atomic uint32_t space_waiters;
+    goon_event_t *spill_head;
+    goon_event_t *spill_tail;
+    goon_disk_queue_t *disk_queue;
+    bool persistent;
+    _Atomic size_t spill_count;
+    _Atomic bool overflow_warned;
+    struct {
+        _Atomic uint64_t rejected;
+        _Atomic uint64_t blocked;
+        _Atomic uint64_t timed_out;
+        _Atomic uint64_t dropped_oldest;
+        _Atomic uint64_t dropped_lowest;
+        _Atomic uint64_t spilled;
+        _Atomic uint64_t unspilled;
+        _Atomic uint64_t spill_high_water;
+    } backpressure;
 };
 
 /* ============================================================================
@@ -174,8 +798,10 @@ struct goon_context {
 
 static goon_context_t *g_goon_ctx = NULL;
 static uint32_t g_next_handler_id = 1;
-static uint32_t g_next_event_id = 1;
+static _Atomic uint32_t g_next_event_id = 1;
 static uint32_t g_next_context_id = 1;
+static goon_symbol_table_t g_symbols = { .lock = PTHREAD_RWLOCK_INITIALIZER };
+static goon_rcu_domain_t g_rcu = { .epoch = 1, .lock = PTHREAD_MUTEX_INITIALIZER, .once = PTHREAD_ONCE_INIT };
 
 /* ============================================================================
  * LOGGING FUNCTIONS
@@ -184,8 +810,9 @@ static uint32_t g_next_context_id = 1;
 void goon_log(goon_log_level_t level, const char *file, int line, const char *fmt, ...) {
     const char *level_str[] = {"DEBUG", "INFO", "WARN", "ERROR"};
     time_t now = time(NULL);
+    struct tm now_tm;
     char time_buf[64];
-    strftime(time_buf, sizeof(time_buf), "%Y-%m-%d %H:%M:%S", localtime(&now));
+    strftime(time_buf, sizeof(time_buf), "%Y-%m-%d %H:%M:%S", localtime_r(&now, &now_tm));
     
     fprintf(stderr, "[%s] [%s] %s:%d - ", time_buf, level_str[level], file, line);
     
@@ -197,22 +824,148 @@ void goon_log(goon_log_level_t level, const char *file, int line, const char *fm
     fprintf(stderr, "\n");
 }
 
+/* ============================================================================
+ * TICK ARENA FUNCTIONS
+ * ============================================================================ */
+
+/*
+ * In arena mode, events and copied payloads created on the thread running
+ * goon_context_process_events() are bump-allocated from the context's
+ * tick arena instead of the heap. Blocks are aligned to their size, so a
+ * pointer finds its arena by masking. Objects only count themselves out
+ * on destroy; once a tick leaves no live objects in a generation it is
+ * rewound in one step. Two generations alternate, so a few events
+ * outliving a tick do not stop the arena from being reused.
+ */
+
+static __thread goon_arena_t *g_tick_arena = NULL;
+
+#define GOON_ARENA_HEADER ((sizeof(goon_arena_block_t) + _Alignof(max_align_t) - 1) & \
+                           ~(_Alignof(max_align_t) - 1))
+
+// `align` is a power of two no larger than the block size
+static void* goon_arena_alloc(goon_arena_t *arena, size_t size, size_t align) {
+    if (align < _Alignof(max_align_t)) align = _Alignof(max_align_t);
+    size = (size + align - 1) & ~(align - 1);
+    if (size > GOON_ARENA_BLOCK_SIZE - GOON_ARENA_HEADER) return NULL;
+    
+    // Blocks are size-aligned, so aligning the offset aligns the address
+    size_t offset = (arena->offset + align - 1) & ~(align - 1);
+    if (!arena->current || offset + size > GOON_ARENA_BLOCK_SIZE) {
+        goon_arena_block_t *next = arena->current ? arena->current->next : arena->head;
+        if (!next) {
+            next = (goon_arena_block_t*)aligned_alloc(GOON_ARENA_BLOCK_SIZE, GOON_ARENA_BLOCK_SIZE);
+            if (!next) return NULL;
+            
+            next->arena = arena;
+            next->next = NULL;
+            if (arena->current) {
+                arena->current->next = next;
+            } else {
+                arena->head = next;
+            }
+            arena->block_count++;
+        }
+        arena->current = next;
+        offset = (GOON_ARENA_HEADER + align - 1) & ~(align - 1);
+    }
+    
+    void *ptr = (uint8_t*)arena->current + offset;
+    arena->offset = offset + size;
+    arena->allocs++;
+    atomic_fetch_add_explicit(&arena->live, 1, memory_order_relaxed);
+    return ptr;
+}
+
+// Any thread may drop an arena object; the memory itself is reclaimed by reset
+static inline void goon_arena_put(const void *ptr) {
+    goon_arena_block_t *block = (goon_arena_block_t*)((uintptr_t)ptr & ~(uintptr_t)(GOON_ARENA_BLOCK_SIZE - 1));
+    atomic_fetch_sub_explicit(&block->arena->live, 1, memory_order_release);
+}
+
+// Caller guarantees no live objects; blocks past the retained few go back to the heap
+static void goon_arena_reset(goon_arena_t *arena) {
+    goon_arena_block_t *block = arena->head;
+    for (size_t kept = 1; block && kept < GOON_ARENA_KEEP_BLOCKS; kept++) {
+        block = block->next;
+    }
+    
+    if (block) {
+        goon_arena_block_t *extra = block->next;
+        block->next = NULL;
+        while (extra) {
+            goon_arena_block_t *next = extra->next;
+            free(extra);
+            arena->block_count--;
+            extra = next;
+        }
+    }
+    
+    arena->current = NULL;
+    arena->offset = 0;
+    arena->resets++;
+}
+
+static void goon_arena_destroy(goon_arena_t *arena) {
+    goon_arena_block_t *block = arena->head;
+    while (block) {
+        goon_arena_block_t *next = block->next;
+        free(block);
+        block = next;
+    }
+    
+    arena->head = NULL;
+    arena->current = NULL;
+    arena->block_count = 0;
+}
+
 /* ============================================================================
  * DATA MANAGEMENT FUNCTIONS
  * ============================================================================ */
 
-goon_data_t* goon_data_create(goon_data_type_t type, void *value, size_t size) {
-    goon_data_t *data = (goon_data_t*)malloc(sizeof(goon_data_t));
+// Bytes a single carve needs for the struct plus a payload too big to inline
+static inline size_t goon_data_carve_size(void *value, size_t size) {
+    return sizeof(goon_data_t) + (value && size > GOON_DATA_INLINE_SIZE ? size : 0);
+}
+
+static goon_data_t* goon_data_init_carved(goon_data_t *data, goon_data_mode_t mode, goon_data_type_t type,
+                                          void *value, size_t size) {
+    data->type = type;
+    data->mode = mode;
+    data->size = size;
+    data->cleanup = NULL;
+    
+    if (value && size > GOON_DATA_INLINE_SIZE) {
+        data->value = data + 1;
+    } else {
+        data->value = value && size > 0 ? (void*)data->inline_value : value;
+    }
+    if (value && size > 0) memcpy(data->value, value, size);
+    
+    return data;
+}
+
+static goon_data_t* goon_data_create_in(goon_arena_t *arena, goon_data_type_t type, void *value, size_t size) {
+    goon_data_t *data = arena ? (goon_data_t*)goon_arena_alloc(arena, goon_data_carve_size(value, size), 0) : NULL;
+    if (data) {
+        return goon_data_init_carved(data, GOON_DATA_ARENA, type, value, size);
+    }
+    
+    data = (goon_data_t*)malloc(sizeof(goon_data_t));
     if (!data) {
         GOON_ERROR_LOG("Failed to allocate memory for goon_data_t");
         return NULL;
     }
     
     data->type = type;
+    data->mode = GOON_DATA_COPY;
     data->size = size;
     data->cleanup = NULL;
     
-    if (value && size > 0) {
+    if (value && size > 0 && size <= GOON_DATA_INLINE_SIZE) {
+        data->value = data->inline_value;
+        memcpy(data->value, value, size);
+    } else if (value && size > 0) {
         data->value = malloc(size);
         if (!data->value) {
             GOON_ERROR_LOG("Failed to allocate memory for data value");
@@ -227,12 +980,49 @@ goon_data_t* goon_data_create(goon_data_type_t type, void *value, size_t size) {
     return data;
 }
 
+goon_data_t* goon_data_create(goon_data_type_t type, void *value, size_t size) {
+    return goon_data_create_in(g_tick_arena, type, value, size);
+}
+
+void* goon_pool_acquire(goon_pool_t *pool, size_t size);
+int goon_pool_release(goon_pool_t *pool, void *obj);
+
+/*
+ * Like goon_data_create(), but the struct and the copied payload come from
+ * the context's memory pool as one object. The data must not outlive the
+ * context.
+ */
+goon_data_t* goon_context_create_data(goon_context_t *ctx, goon_data_type_t type, void *value, size_t size) {
+    if (!ctx) return NULL;
+    
+    goon_data_t *data = (goon_data_t*)goon_pool_acquire(ctx->memory_pool, goon_data_carve_size(value, size));
+    if (!data) return NULL;
+    
+    return goon_data_init_carved(data, GOON_DATA_POOL, type, value, size);
+}
+
+static inline bool goon_data_is_inline(const goon_data_t *data) {
+    return data->value == (const void*)data->inline_value;
+}
+
+void goon_shared_release(goon_shared_t *shared);
+
 void goon_data_destroy(goon_data_t *data) {
     if (!data) return;
     
-    if (data->cleanup && data->value) {
+    if (data->mode == GOON_DATA_SHARED) {
+        goon_shared_release(data->shared);
+    } else if (data->mode == GOON_DATA_ARENA) {
+        goon_arena_put(data);
+        return;
+    } else if (data->mode == GOON_DATA_POOL) {
+        goon_pool_release(((goon_pool_block_t*)data - 1)->pool, data);
+        return;
+    } else if (data->mode == GOON_DATA_BORROW) {
+        // Owned by the caller
+    } else if (data->cleanup && data->value) {
         data->cleanup(data->value);
-    } else if (data->value && data->size > 0) {
+    } else if (data->value && data->size > 0 && !goon_data_is_inline(data)) {
         free(data->value);
     }
     
@@ -241,6 +1031,21 @@ void goon_data_destroy(goon_data_t *data) {
 
 int goon_data_set_cleanup(goon_data_t *data, goon_cleanup_func cleanup) {
     if (!data) return GOON_ERROR_NULL_PTR;
+    if (data->mode != GOON_DATA_COPY && data->mode != GOON_DATA_MOVE) {
+        return GOON_ERROR_INVALID_PARAM;
+    }
+    
+    // A cleanup owns the copy and may free() it, so it has to be on the heap
+    if (cleanup && goon_data_is_inline(data)) {
+        void *value = malloc(data->size);
+        if (!value) {
+            GOON_ERROR_LOG("Failed to allocate memory for data value");
+            return GOON_ERROR_OUT_OF_MEMORY;
+        }
+        memcpy(value, data->inline_value, data->size);
+        data->value = value;
+    }
+    
     data->cleanup = cleanup;
     return GOON_SUCCESS;
 }
@@ -255,1164 +1060,7149 @@ goon_data_type_t goon_data_get_type(goon_data_t *data) {
     return data->type;
 }
 
-/* ============================================================================
- * EVENT MANAGEMENT FUNCTIONS
- * ============================================================================ */
+/*
+ * Wrap `value` without copying it. GOON_DATA_MOVE takes ownership and
+ * releases it with `cleanup` (free() when NULL) on destroy;
+ * GOON_DATA_BORROW never releases it, so the caller must keep it alive
+ * until the data is destroyed. GOON_DATA_COPY behaves like
+ * goon_data_create(). Any other mode returns NULL: shared payloads go
+ * through goon_data_create_shared(), arena and pool data through
+ * goon_data_create_in() and goon_context_create_data().
+ */
+goon_data_t* goon_data_create_owned(goon_data_type_t type, void *value, size_t size,
+                                    goon_data_mode_t mode, goon_cleanup_func cleanup) {
+    if (mode == GOON_DATA_COPY) {
+        goon_data_t *data = goon_data_create(type, value, size);
+        if (data && cleanup && goon_data_set_cleanup(data, cleanup) != GOON_SUCCESS) {
+            goon_data_destroy(data);
+            return NULL;
+        }
+        return data;
+    }
+    if (mode != GOON_DATA_MOVE && mode != GOON_DATA_BORROW) return NULL;
+    
+    goon_data_t *data = (goon_data_t*)malloc(sizeof(goon_data_t));
+    if (!data) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_data_t");
+        return NULL;
+    }
+    
+    data->type = type;
+    data->mode = mode;
+    data->size = size;
+    data->value = value;
+    data->cleanup = mode == GOON_DATA_MOVE ? (cleanup ? cleanup : free) : NULL;
+    return data;
+}
 
-goon_event_t* goon_event_create(const char *name, goon_priority_t priority) {
-    goon_event_t *event = (goon_event_t*)malloc(sizeof(goon_event_t));
-    if (!event) {
-        GOON_ERROR_LOG("Failed to allocate memory for goon_event_t");
+goon_shared_t* goon_shared_create(void *value, size_t size, goon_cleanup_func cleanup) {
+    goon_shared_t *shared = (goon_shared_t*)malloc(sizeof(goon_shared_t));
+    if (!shared) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_shared_t");
         return NULL;
     }
     
-    event->id = g_next_event_id++;
-    strncpy(event->name, name, GOON_MAX_NAME_LEN - 1);
-    event->name[GOON_MAX_NAME_LEN - 1] = '\0';
-    event->priority = priority;
-    event->timestamp = time(NULL);
-    event->data = NULL;
-    event->user_data = NULL;
-    event->next = NULL;
+    atomic_init(&shared->refs, 1);
+    shared->size = size;
+    shared->value = value;
+    shared->cleanup = cleanup ? cleanup : free;
+    return shared;
+}
+
+goon_shared_t* goon_shared_retain(goon_shared_t *shared) {
+    if (shared) atomic_fetch_add_explicit(&shared->refs, 1, memory_order_relaxed);
+    return shared;
+}
+
+void goon_shared_release(goon_shared_t *shared) {
+    if (!shared) return;
     
-    return event;
+    if (atomic_fetch_sub_explicit(&shared->refs, 1, memory_order_acq_rel) == 1) {
+        if (shared->value) shared->cleanup(shared->value);
+        free(shared);
+    }
 }
 
-void goon_event_destroy(goon_event_t *event) {
-    if (!event) return;
+/*
+ * Attach a shared payload, taking a new reference. Every data built from
+ * it sees the same bytes, so handlers must treat them as read-only.
+ */
+goon_data_t* goon_data_create_shared(goon_data_type_t type, goon_shared_t *shared) {
+    if (!shared) return NULL;
     
-    if (event->data) {
-        goon_data_destroy(event->data);
+    goon_data_t *data = (goon_data_t*)malloc(sizeof(goon_data_t));
+    if (!data) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_data_t");
+        return NULL;
     }
     
-    free(event);
+    data->type = type;
+    data->mode = GOON_DATA_SHARED;
+    data->size = shared->size;
+    data->value = shared->value;
+    data->cleanup = NULL;
+    data->shared = goon_shared_retain(shared);
+    return data;
 }
 
-int goon_event_set_data(goon_event_t *event, goon_data_t *data) {
-    if (!event) return GOON_ERROR_NULL_PTR;
+/*
+ * Copy an arena payload to the heap so it can outlive the tick. On success
+ * the arena copy is destroyed and the heap copy returned; on failure NULL
+ * is returned and `data` is untouched. Other payloads are returned as is.
+ */
+goon_data_t* goon_data_promote(goon_data_t *data) {
+    if (!data || data->mode != GOON_DATA_ARENA) return data;
     
-    if (event->data) {
-        goon_data_destroy(event->data);
-    }
+    goon_data_t *copy = goon_data_create_in(NULL, data->type, data->value, data->size);
+    if (!copy) return NULL;
     
-    event->data = data;
-    return GOON_SUCCESS;
+    // Payload-less data may carry a caller pointer rather than arena bytes
+    if (data->size == 0) copy->value = data->value;
+    
+    goon_data_destroy(data);
+    return copy;
 }
 
-goon_data_t* goon_event_get_data(goon_event_t *event) {
-    if (!event) return NULL;
-    return event->data;
+goon_data_mode_t goon_data_get_mode(goon_data_t *data) {
+    if (!data) return GOON_DATA_COPY;
+    return data->mode;
+}
+
+// Shared and borrowed payloads are referenced again; owned bytes are copied
+goon_data_t* goon_data_clone(goon_data_t *data) {
+    if (!data) return NULL;
+    
+    if (data->mode == GOON_DATA_SHARED) {
+        return goon_data_create_shared(data->type, data->shared);
+    }
+    if (data->mode == GOON_DATA_BORROW) {
+        return goon_data_create_owned(data->type, data->value, data->size, GOON_DATA_BORROW, NULL);
+    }
+    return goon_data_create(data->type, data->value, data->size);
 }
 
 /* ============================================================================
- * QUEUE MANAGEMENT FUNCTIONS
+ * SYMBOL TABLE FUNCTIONS
  * ============================================================================ */
 
-goon_queue_t* goon_queue_create(size_t max_size) {
-    goon_queue_t *queue = (goon_queue_t*)malloc(sizeof(goon_queue_t));
-    if (!queue) {
-        GOON_ERROR_LOG("Failed to allocate memory for goon_queue_t");
-        return NULL;
+/*
+ * Process-wide interning of event names. Each distinct name is stored once
+ * and identified by a dense 32-bit symbol; its hash is computed at intern
+ * time. Entries live in fixed chunks that never move, so resolving a symbol
+ * back to its name or hash needs no lock. Symbols are never released.
+ */
+
+static uint64_t goon_hash_bytes(const char *str, size_t length) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)str[i];
+        hash *= 1099511628211ULL;
     }
-    
-    queue->head = NULL;
-    queue->tail = NULL;
-    queue->size = 0;
-    queue->max_size = max_size > 0 ? max_size : GOON_MAX_QUEUE_SIZE;
-    
-    return queue;
+    return hash;
 }
 
-void goon_queue_destroy(goon_queue_t *queue) {
-    if (!queue) return;
-    
-    goon_event_t *current = queue->head;
-    while (current) {
-        goon_event_t *next = current->next;
-        goon_event_destroy(current);
-        current = next;
+static uint64_t goon_hash_string(const char *str) {
+    uint64_t hash = 14695981039346656037ULL;
+    while (*str) {
+        hash ^= (unsigned char)*str++;
+        hash *= 1099511628211ULL;
     }
-    
-    free(queue);
+    return hash;
 }
 
-int goon_queue_push(goon_queue_t *queue, goon_event_t *event) {
-    if (!queue || !event) return GOON_ERROR_NULL_PTR;
+static goon_symbol_entry_t* goon_symbol_entry(goon_symbol_t sym) {
+    return &g_symbols.chunks[sym >> GOON_SYMBOL_CHUNK_BITS][sym & (GOON_SYMBOL_CHUNK - 1)];
+}
+
+static goon_symbol_t goon_symbol_find(const char *name, size_t length, uint64_t hash) {
+    if (!g_symbols.index) return GOON_SYMBOL_NONE;
     
-    if (queue->size >= queue->max_size) {
-        GOON_WARN("Queue is full, cannot push event");
-        return GOON_ERROR_OVERFLOW;
+    size_t mask = g_symbols.index_capacity - 1;
+    for (size_t i = hash & mask; g_symbols.index[i] != GOON_SYMBOL_NONE; i = (i + 1) & mask) {
+        goon_symbol_entry_t *entry = goon_symbol_entry(g_symbols.index[i]);
+        if (entry->hash == hash && entry->length == length && memcmp(entry->name, name, length) == 0) {
+            return g_symbols.index[i];
+        }
     }
     
-    event->next = NULL;
+    return GOON_SYMBOL_NONE;
+}
+
+static int goon_symbol_index_grow(void) {
+    size_t capacity = g_symbols.index_capacity ? g_symbols.index_capacity * 2 : GOON_SYMBOL_INDEX_INITIAL;
+    goon_symbol_t *index = (goon_symbol_t*)calloc(capacity, sizeof(goon_symbol_t));
+    if (!index) return GOON_ERROR_OUT_OF_MEMORY;
     
-    if (queue->tail) {
-        queue->tail->next = event;
-    } else {
-        queue->head = event;
+    uint32_t count = atomic_load_explicit(&g_symbols.count, memory_order_relaxed);
+    for (goon_symbol_t sym = 1; sym <= count; sym++) {
+        size_t i = goon_symbol_entry(sym)->hash & (capacity - 1);
+        while (index[i] != GOON_SYMBOL_NONE) {
+            i = (i + 1) & (capacity - 1);
+        }
+        index[i] = sym;
     }
     
-    queue->tail = event;
-    queue->size++;
-    
+    free(g_symbols.index);
+    g_symbols.index = index;
+    g_symbols.index_capacity = capacity;
     return GOON_SUCCESS;
 }
 
-goon_event_t* goon_queue_pop(goon_queue_t *queue) {
-    if (!queue || !queue->head) return NULL;
+goon_symbol_t goon_symbol_lookup(const char *name) {
+    if (!name) return GOON_SYMBOL_NONE;
     
-    goon_event_t *event = queue->head;
-    queue->head = event->next;
+    size_t length = strnlen(name, GOON_MAX_NAME_LEN - 1);
+    uint64_t hash = goon_hash_bytes(name, length);
     
-    if (!queue->head) {
-        queue->tail = NULL;
+    pthread_rwlock_rdlock(&g_symbols.lock);
+    goon_symbol_t sym = goon_symbol_find(name, length, hash);
+    pthread_rwlock_unlock(&g_symbols.lock);
+    
+    return sym;
+}
+
+goon_symbol_t goon_symbol_intern(const char *name) {
+    if (!name) return GOON_SYMBOL_NONE;
+    
+    // Names keep the historical limit of GOON_MAX_NAME_LEN - 1 bytes
+    size_t length = strnlen(name, GOON_MAX_NAME_LEN - 1);
+    uint64_t hash = goon_hash_bytes(name, length);
+    
+    pthread_rwlock_rdlock(&g_symbols.lock);
+    goon_symbol_t sym = goon_symbol_find(name, length, hash);
+    pthread_rwlock_unlock(&g_symbols.lock);
+    if (sym != GOON_SYMBOL_NONE) return sym;
+    
+    pthread_rwlock_wrlock(&g_symbols.lock);
+    
+    sym = goon_symbol_find(name, length, hash);
+    if (sym != GOON_SYMBOL_NONE) {
+        pthread_rwlock_unlock(&g_symbols.lock);
+        return sym;
     }
     
-    event->next = NULL;
-    queue->size--;
+    uint32_t count = atomic_load_explicit(&g_symbols.count, memory_order_relaxed);
+    sym = count + 1;
     
-    return event;
+    if ((sym >> GOON_SYMBOL_CHUNK_BITS) >= GOON_SYMBOL_CHUNKS) {
+        pthread_rwlock_unlock(&g_symbols.lock);
+        GOON_ERROR_LOG("Symbol table is full");
+        return GOON_SYMBOL_NONE;
+    }
+    
+    if ((size_t)sym * 2 > g_symbols.index_capacity && goon_symbol_index_grow() != GOON_SUCCESS) {
+        pthread_rwlock_unlock(&g_symbols.lock);
+        GOON_ERROR_LOG("Failed to grow symbol index");
+        return GOON_SYMBOL_NONE;
+    }
+    
+    goon_symbol_entry_t **chunk = &g_symbols.chunks[sym >> GOON_SYMBOL_CHUNK_BITS];
+    if (!*chunk) {
+        *chunk = (goon_symbol_entry_t*)calloc(GOON_SYMBOL_CHUNK, sizeof(goon_symbol_entry_t));
+    }
+    
+    char *copy = (char*)malloc(length + 1);
+    if (!*chunk || !copy) {
+        free(copy);
+        pthread_rwlock_unlock(&g_symbols.lock);
+        GOON_ERROR_LOG("Failed to allocate memory for symbol '%s'", name);
+        return GOON_SYMBOL_NONE;
+    }
+    
+    memcpy(copy, name, length);
+    copy[length] = '\0';
+    
+    goon_symbol_entry_t *entry = goon_symbol_entry(sym);
+    entry->name = copy;
+    entry->hash = hash;
+    entry->length = length;
+    
+    size_t mask = g_symbols.index_capacity - 1;
+    size_t i = hash & mask;
+    while (g_symbols.index[i] != GOON_SYMBOL_NONE) {
+        i = (i + 1) & mask;
+    }
+    g_symbols.index[i] = sym;
+    atomic_store_explicit(&g_symbols.count, sym, memory_order_release);
+    
+    pthread_rwlock_unlock(&g_symbols.lock);
+    return sym;
 }
 
-size_t goon_queue_size(goon_queue_t *queue) {
-    if (!queue) return 0;
-    return queue->size;
+const char* goon_symbol_name(goon_symbol_t sym) {
+    if (sym == GOON_SYMBOL_NONE || sym > atomic_load_explicit(&g_symbols.count, memory_order_acquire)) {
+        return "";
+    }
+    return goon_symbol_entry(sym)->name;
 }
 
-bool goon_queue_is_empty(goon_queue_t *queue) {
-    if (!queue) return true;
-    return queue->size == 0;
+uint64_t goon_symbol_hash(goon_symbol_t sym) {
+    if (sym == GOON_SYMBOL_NONE || sym > atomic_load_explicit(&g_symbols.count, memory_order_acquire)) {
+        return 0;
+    }
+    return goon_symbol_entry(sym)->hash;
+}
+
+size_t goon_symbol_count(void) {
+    return atomic_load(&g_symbols.count);
 }
 
 /* ============================================================================
- * STACK MANAGEMENT FUNCTIONS
+ * EVENT SLAB FUNCTIONS
  * ============================================================================ */
 
-goon_stack_t* goon_stack_create(size_t capacity) {
-    goon_stack_t *stack = (goon_stack_t*)malloc(sizeof(goon_stack_t));
-    if (!stack) {
-        GOON_ERROR_LOG("Failed to allocate memory for goon_stack_t");
-        return NULL;
-    }
-    
-    stack->capacity = capacity > 0 ? capacity : GOON_MAX_STACK_SIZE;
-    stack->items = (void**)calloc(stack->capacity, sizeof(void*));
-    if (!stack->items) {
-        GOON_ERROR_LOG("Failed to allocate memory for stack items");
-        free(stack);
+/*
+ * Each context carves its events out of fixed-size chunks. Free slots
+ * travel between threads in magazines: a thread keeps a loaded and a
+ * previous magazine per slab it touches, so create and destroy are a
+ * pointer pop or push, and the slab lock is only taken to trade a whole
+ * magazine with the depot. A consumer destroying a producer's events
+ * fills its own magazines and hands them back in bulk.
+ */
+
+static pthread_once_t g_slab_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_slab_key;
+static __thread goon_slab_cache_t g_slab_cache[GOON_SLAB_CACHE_WAYS];
+static __thread uint32_t g_slab_victim = 0;
+
+// Chunks are line-aligned and so is the first slot; events fill whole slots
+#define GOON_SLAB_CHUNK_HEADER GOON_CACHE_LINE
+#define GOON_SLAB_CHUNK_BYTES(slot_size) \
+    ((GOON_SLAB_CHUNK_HEADER + GOON_SLAB_CHUNK_SLOTS * (slot_size) + GOON_CACHE_LINE - 1) & ~(size_t)(GOON_CACHE_LINE - 1))
+
+goon_event_slab_t* goon_event_slab_create(size_t object_size) {
+    goon_event_slab_t *slab = (goon_event_slab_t*)calloc(1, sizeof(goon_event_slab_t));
+    if (!slab) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_event_slab_t");
         return NULL;
     }
     
-    stack->size = 0;
-    
-    return stack;
+    size_t align = _Alignof(max_align_t);
+    slab->slot_size = (object_size + align - 1) & ~(align - 1);
+    pthread_mutex_init(&slab->lock, NULL);
+    atomic_init(&slab->refs, 1);
+    return slab;
 }
 
-void goon_stack_destroy(goon_stack_t *stack) {
-    if (!stack) return;
+// Frees the chunks once the owner and every thread cache have let go
+void goon_event_slab_release(goon_event_slab_t *slab) {
+    if (!slab || atomic_fetch_sub(&slab->refs, 1) != 1) return;
     
-    if (stack->items) {
-        free(stack->items);
+    while (slab->chunks) {
+        goon_slab_chunk_t *next = slab->chunks->next;
+        free(slab->chunks);
+        slab->chunks = next;
     }
     
-    free(stack);
-}
-
-int goon_stack_push(goon_stack_t *stack, void *item) {
-    if (!stack) return GOON_ERROR_NULL_PTR;
-    
-    if (stack->size >= stack->capacity) {
-        GOON_WARN("Stack is full, cannot push item");
-        return GOON_ERROR_OVERFLOW;
+    goon_slab_magazine_t *lists[2] = { slab->full, slab->empty };
+    for (int i = 0; i < 2; i++) {
+        while (lists[i]) {
+            goon_slab_magazine_t *next = lists[i]->next;
+            free(lists[i]);
+            lists[i] = next;
+        }
     }
     
-    stack->items[stack->size++] = item;
-    return GOON_SUCCESS;
+    pthread_mutex_destroy(&slab->lock);
+    free(slab);
 }
 
-void* goon_stack_pop(goon_stack_t *stack) {
-    if (!stack || stack->size == 0) return NULL;
-    
-    return stack->items[--stack->size];
+// Caller holds slab->lock
+static void goon_slab_fold_counts(goon_event_slab_t *slab, goon_slab_cache_t *cache) {
+    slab->allocs += cache->allocs;
+    slab->frees += cache->frees;
+    cache->allocs = 0;
+    cache->frees = 0;
 }
 
-void* goon_stack_peek(goon_stack_t *stack) {
-    if (!stack || stack->size == 0) return NULL;
+// Hand a thread's magazines back to the depot and drop its reference
+static void goon_slab_cache_flush(goon_slab_cache_t *cache) {
+    goon_event_slab_t *slab = cache->slab;
+    if (!slab) return;
     
-    return stack->items[stack->size - 1];
+    pthread_mutex_lock(&slab->lock);
+    goon_slab_magazine_t *magazines[2] = { cache->loaded, cache->previous };
+    for (int i = 0; i < 2; i++) {
+        goon_slab_magazine_t *magazine = magazines[i];
+        if (!magazine) continue;
+        
+        if (magazine->count > 0) {
+            magazine->next = slab->full;
+            slab->full = magazine;
+            slab->depot_free += magazine->count;
+        } else {
+            magazine->next = slab->empty;
+            slab->empty = magazine;
+        }
+    }
+    goon_slab_fold_counts(slab, cache);
+    pthread_mutex_unlock(&slab->lock);
+    
+    memset(cache, 0, sizeof(*cache));
+    goon_event_slab_release(slab);
 }
 
-size_t goon_stack_size(goon_stack_t *stack) {
-    if (!stack) return 0;
-    return stack->size;
+static void goon_slab_thread_exit(void *arg) {
+    goon_slab_cache_t *caches = (goon_slab_cache_t*)arg;
+    for (int i = 0; i < GOON_SLAB_CACHE_WAYS; i++) {
+        goon_slab_cache_flush(&caches[i]);
+    }
 }
 
-bool goon_stack_is_empty(goon_stack_t *stack) {
-    if (!stack) return true;
-    return stack->size == 0;
+static void goon_slab_create_key(void) {
+    pthread_key_create(&g_slab_key, goon_slab_thread_exit);
 }
 
-/* ============================================================================
- * CACHE MANAGEMENT FUNCTIONS
- * ============================================================================ */
-
-goon_cache_t* goon_cache_create(void) {
-    goon_cache_t *cache = (goon_cache_t*)malloc(sizeof(goon_cache_t));
-    if (!cache) {
-        GOON_ERROR_LOG("Failed to allocate memory for goon_cache_t");
-        return NULL;
+// Threads feeding more slabs than cache ways evict round-robin
+static goon_slab_cache_t* goon_slab_cache_get(goon_event_slab_t *slab) {
+    goon_slab_cache_t *spare = NULL;
+    for (int i = 0; i < GOON_SLAB_CACHE_WAYS; i++) {
+        if (g_slab_cache[i].slab == slab) return &g_slab_cache[i];
+        if (!spare && !g_slab_cache[i].slab) spare = &g_slab_cache[i];
     }
     
-    memset(cache->keys, 0, sizeof(cache->keys));
-    memset(cache->values, 0, sizeof(cache->values));
-    memset(cache->timestamps, 0, sizeof(cache->timestamps));
-    memset(cache->sizes, 0, sizeof(cache->sizes));
-    cache->count = 0;
+    if (!spare) {
+        spare = &g_slab_cache[g_slab_victim++ % GOON_SLAB_CACHE_WAYS];
+        goon_slab_cache_flush(spare);
+    }
     
-    return cache;
+    pthread_once(&g_slab_once, goon_slab_create_key);
+    pthread_setspecific(g_slab_key, g_slab_cache);
+    
+    atomic_fetch_add(&slab->refs, 1);
+    spare->slab = slab;
+    return spare;
 }
 
-void goon_cache_destroy(goon_cache_t *cache) {
-    if (!cache) return;
-    
-    for (size_t i = 0; i < cache->count; i++) {
-        if (cache->values[i]) {
-            free(cache->values[i]);
+// Flush the calling thread's magazines for a slab whose owner is going away
+static void goon_event_slab_detach(goon_event_slab_t *slab) {
+    for (int i = 0; i < GOON_SLAB_CACHE_WAYS; i++) {
+        if (g_slab_cache[i].slab == slab) {
+            goon_slab_cache_flush(&g_slab_cache[i]);
         }
     }
-    
-    free(cache);
 }
 
-int goon_cache_set(goon_cache_t *cache, const char *key, void *value, size_t size) {
-    if (!cache || !key || !value) return GOON_ERROR_NULL_PTR;
+static goon_slab_magazine_t* goon_slab_magazine_get(goon_event_slab_t *slab) {
+    goon_slab_magazine_t *magazine = slab->empty;
+    if (magazine) {
+        slab->empty = magazine->next;
+    } else if ((magazine = (goon_slab_magazine_t*)malloc(sizeof(goon_slab_magazine_t))) != NULL) {
+        slab->magazine_count++;
+    }
     
-    // Check if key exists
-    for (size_t i = 0; i < cache->count; i++) {
-        if (strcmp(cache->keys[i], key) == 0) {
-            if (cache->values[i]) {
-                free(cache->values[i]);
-            }
-            
-            cache->values[i] = malloc(size);
-            if (!cache->values[i]) {
-                return GOON_ERROR_OUT_OF_MEMORY;
-            }
-            
-            memcpy(cache->values[i], value, size);
-            cache->sizes[i] = size;
-            cache->timestamps[i] = time(NULL);
-            return GOON_SUCCESS;
+    if (magazine) {
+        magazine->next = NULL;
+        magazine->count = 0;
+    }
+    return magazine;
+}
+
+static void* goon_event_slab_alloc_slow(goon_event_slab_t *slab, goon_slab_cache_t *cache) {
+    pthread_mutex_lock(&slab->lock);
+    slab->exchanges++;
+    goon_slab_fold_counts(slab, cache);
+    
+    // Trade the empty previous magazine for a full one from the depot
+    goon_slab_magazine_t *full = slab->full;
+    if (full) {
+        slab->full = full->next;
+        slab->depot_free -= full->count;
+        if (cache->previous) {
+            cache->previous->next = slab->empty;
+            slab->empty = cache->previous;
         }
+        cache->previous = cache->loaded;
+        cache->loaded = full;
+        pthread_mutex_unlock(&slab->lock);
+        return full->slots[--full->count];
     }
     
-    // Add new entry
-    if (cache->count >= GOON_CACHE_SIZE) {
-        // Evict oldest entry
-        size_t oldest_idx = 0;
-        time_t oldest_time = cache->timestamps[0];
-        
-        for (size_t i = 1; i < GOON_CACHE_SIZE; i++) {
-            if (cache->timestamps[i] < oldest_time) {
-                oldest_time = cache->timestamps[i];
-                oldest_idx = i;
-            }
-        }
-        
-        if (cache->values[oldest_idx]) {
-            free(cache->values[oldest_idx]);
-        }
-        
-        strncpy(cache->keys[oldest_idx], key, GOON_MAX_NAME_LEN - 1);
-        cache->keys[oldest_idx][GOON_MAX_NAME_LEN - 1] = '\0';
-        
-        cache->values[oldest_idx] = malloc(size);
-        if (!cache->values[oldest_idx]) {
-            return GOON_ERROR_OUT_OF_MEMORY;
-        }
-        
-        memcpy(cache->values[oldest_idx], value, size);
-        cache->sizes[oldest_idx] = size;
-        cache->timestamps[oldest_idx] = time(NULL);
-    } else {
-        strncpy(cache->keys[cache->count], key, GOON_MAX_NAME_LEN - 1);
-        cache->keys[cache->count][GOON_MAX_NAME_LEN - 1] = '\0';
-        
-        cache->values[cache->count] = malloc(size);
-        if (!cache->values[cache->count]) {
-            return GOON_ERROR_OUT_OF_MEMORY;
+    if (slab->loose) {
+        void *obj = slab->loose;
+        slab->loose = *(void**)obj;
+        slab->depot_free--;
+        pthread_mutex_unlock(&slab->lock);
+        return obj;
+    }
+    
+    if (slab->carve_left == 0) {
+        goon_slab_chunk_t *chunk = (goon_slab_chunk_t*)aligned_alloc(GOON_CACHE_LINE,
+                                                                     GOON_SLAB_CHUNK_BYTES(slab->slot_size));
+        if (!chunk) {
+            pthread_mutex_unlock(&slab->lock);
+            GOON_ERROR_LOG("Failed to allocate memory for event slab chunk");
+            return NULL;
         }
         
-        memcpy(cache->values[cache->count], value, size);
-        cache->sizes[cache->count] = size;
-        cache->timestamps[cache->count] = time(NULL);
-        cache->count++;
+        chunk->next = slab->chunks;
+        slab->chunks = chunk;
+        slab->chunk_count++;
+        slab->carve = (uint8_t*)chunk + GOON_SLAB_CHUNK_HEADER;
+        slab->carve_left = GOON_SLAB_CHUNK_SLOTS;
+        slab->capacity += GOON_SLAB_CHUNK_SLOTS;
     }
     
-    return GOON_SUCCESS;
-}
-
-void* goon_cache_get(goon_cache_t *cache, const char *key, size_t *size) {
-    if (!cache || !key) return NULL;
+    void *obj = slab->carve;
+    slab->carve += slab->slot_size;
+    slab->carve_left--;
     
-    for (size_t i = 0; i < cache->count; i++) {
-        if (strcmp(cache->keys[i], key) == 0) {
-            cache->timestamps[i] = time(NULL);
-            if (size) {
-                *size = cache->sizes[i];
-            }
-            return cache->values[i];
-        }
+    // Carve a magazine's worth at once so the next allocations stay local
+    if (!cache->loaded) {
+        cache->loaded = goon_slab_magazine_get(slab);
+    }
+    goon_slab_magazine_t *magazine = cache->loaded;
+    while (magazine && magazine->count < GOON_SLAB_MAGAZINE_SIZE && slab->carve_left > 0) {
+        magazine->slots[magazine->count++] = slab->carve;
+        slab->carve += slab->slot_size;
+        slab->carve_left--;
     }
     
-    return NULL;
+    pthread_mutex_unlock(&slab->lock);
+    return obj;
 }
 
-int goon_cache_remove(goon_cache_t *cache, const char *key) {
-    if (!cache || !key) return GOON_ERROR_NULL_PTR;
-    
-    for (size_t i = 0; i < cache->count; i++) {
-        if (strcmp(cache->keys[i], key) == 0) {
-            if (cache->values[i]) {
-                free(cache->values[i]);
-            }
-            
-            // Shift remaining entries
-            for (size_t j = i; j < cache->count - 1; j++) {
-                strcpy(cache->keys[j], cache->keys[j + 1]);
-                cache->values[j] = cache->values[j + 1];
-                cache->sizes[j] = cache->sizes[j + 1];
-                cache->timestamps[j] = cache->timestamps[j + 1];
-            }
-            
-            cache->count--;
-            return GOON_SUCCESS;
-        }
+static void* goon_event_slab_alloc(goon_event_slab_t *slab) {
+    goon_slab_cache_t *cache = goon_slab_cache_get(slab);
+    goon_slab_magazine_t *loaded = cache->loaded;
+    void *obj;
+    
+    if (loaded && loaded->count > 0) {
+        obj = loaded->slots[--loaded->count];
+    } else if (cache->previous && cache->previous->count > 0) {
+        cache->loaded = cache->previous;
+        cache->previous = loaded;
+        obj = cache->loaded->slots[--cache->loaded->count];
+    } else {
+        obj = goon_event_slab_alloc_slow(slab, cache);
     }
     
-    return GOON_ERROR_NOT_FOUND;
+    if (obj) cache->allocs++;
+    return obj;
 }
 
-void goon_cache_clear(goon_cache_t *cache) {
-    if (!cache) return;
+static void goon_event_slab_free_slow(goon_event_slab_t *slab, goon_slab_cache_t *cache, void *obj) {
+    pthread_mutex_lock(&slab->lock);
+    slab->exchanges++;
+    goon_slab_fold_counts(slab, cache);
+    
+    goon_slab_magazine_t *empty = goon_slab_magazine_get(slab);
+    if (!empty) {
+        // No magazine to spare: thread the slot onto the depot directly
+        *(void**)obj = slab->loose;
+        slab->loose = obj;
+        slab->depot_free++;
+        pthread_mutex_unlock(&slab->lock);
+        return;
+    }
     
-    for (size_t i = 0; i < cache->count; i++) {
-        if (cache->values[i]) {
-            free(cache->values[i]);
-            cache->values[i] = NULL;
-        }
+    // Both magazines are full: the previous one goes to the depot
+    if (cache->previous) {
+        cache->previous->next = slab->full;
+        slab->full = cache->previous;
+        slab->depot_free += cache->previous->count;
     }
+    cache->previous = cache->loaded;
+    cache->loaded = empty;
+    pthread_mutex_unlock(&slab->lock);
     
-    cache->count = 0;
+    empty->slots[empty->count++] = obj;
 }
 
-/* ============================================================================
- * MEMORY POOL FUNCTIONS
+static void goon_event_slab_free(goon_event_slab_t *slab, void *obj) {
+    goon_slab_cache_t *cache = goon_slab_cache_get(slab);
+    goon_slab_magazine_t *loaded = cache->loaded;
+    
+    cache->frees++;
+    if (loaded && loaded->count < GOON_SLAB_MAGAZINE_SIZE) {
+        loaded->slots[loaded->count++] = obj;
+    } else if (cache->previous && cache->previous->count < GOON_SLAB_MAGAZINE_SIZE) {
+        cache->loaded = cache->previous;
+        cache->previous = loaded;
+        cache->loaded->slots[cache->loaded->count++] = obj;
+    } else {
+        goon_event_slab_free_slow(slab, cache, obj);
+    }
+}
+
+/*
+ * Occupancy as seen by the depot. Slots sitting in other threads'
+ * magazines count as outstanding, and per-thread alloc/free counts are
+ * folded in whenever a thread trades a magazine, so both lag live usage
+ * by at most two magazines per thread.
+ */
+int goon_event_slab_get_stats(goon_event_slab_t *slab, goon_slab_stats_t *stats) {
+    if (!slab || !stats) return GOON_ERROR_NULL_PTR;
+    
+    pthread_mutex_lock(&slab->lock);
+    stats->slot_size = slab->slot_size;
+    stats->chunks = slab->chunk_count;
+    stats->capacity = slab->capacity;
+    stats->depot_free = slab->depot_free + slab->carve_left;
+    stats->outstanding = slab->capacity - stats->depot_free;
+    stats->magazines = slab->magazine_count;
+    stats->bytes = slab->chunk_count * GOON_SLAB_CHUNK_BYTES(slab->slot_size) +
+                   slab->magazine_count * sizeof(goon_slab_magazine_t);
+    stats->allocs = slab->allocs;
+    stats->frees = slab->frees;
+    stats->exchanges = slab->exchanges;
+    pthread_mutex_unlock(&slab->lock);
+    
+    // The calling thread has not folded its latest counts in yet
+    for (int i = 0; i < GOON_SLAB_CACHE_WAYS; i++) {
+        if (g_slab_cache[i].slab == slab) {
+            stats->allocs += g_slab_cache[i].allocs;
+            stats->frees += g_slab_cache[i].frees;
+        }
+    }
+    
+    return GOON_SUCCESS;
+}
+
+/* ============================================================================
+ * EVENT MANAGEMENT FUNCTIONS
  * ============================================================================ */
 
-goon_pool_t* goon_pool_create(size_t capacity, goon_alloc_func alloc, goon_free_func free_func) {
-    goon_pool_t *pool = (goon_pool_t*)malloc(sizeof(goon_pool_t));
-    if (!pool) {
-        GOON_ERROR_LOG("Failed to allocate memory for goon_pool_t");
-        return NULL;
+static inline uint64_t goon_realtime_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static goon_event_t* goon_event_alloc(goon_event_slab_t *slab, goon_symbol_t sym, goon_priority_t priority) {
+    goon_event_t *event = NULL;
+    bool in_arena = false;
+    
+    if (slab) {
+        event = (goon_event_t*)goon_event_slab_alloc(slab);
+    } else if (g_tick_arena &&
+               (event = (goon_event_t*)goon_arena_alloc(g_tick_arena, sizeof(goon_event_t), GOON_CACHE_LINE))) {
+        in_arena = true;
+    } else {
+        event = (goon_event_t*)aligned_alloc(GOON_CACHE_LINE, GOON_CACHE_LINE);
     }
     
-    pool->capacity = capacity > 0 ? capacity : GOON_POOL_SIZE;
-    pool->objects = (void**)calloc(pool->capacity, sizeof(void*));
-    pool->in_use = (bool*)calloc(pool->capacity, sizeof(bool));
-    
-    if (!pool->objects || !pool->in_use) {
-        GOON_ERROR_LOG("Failed to allocate memory for pool arrays");
-        if (pool->objects) free(pool->objects);
-        if (pool->in_use) free(pool->in_use);
-        free(pool);
+    if (!event) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_event_t");
         return NULL;
     }
     
-    pool->size = 0;
-    pool->alloc = alloc ? alloc : malloc;
-    pool->free = free_func ? free_func : free;
+    event->id = atomic_fetch_add_explicit(&g_next_event_id, 1, memory_order_relaxed);
+    event->sym = sym;
+    event->priority = (uint8_t)priority;
+    event->in_arena = in_arena;
+    event->reserved = 0;
+    event->timestamp_ns = goon_realtime_ns();
+    event->data = NULL;
+    event->user_data = NULL;
+    atomic_init(&event->coalesce_slot, 0);
+    event->slab = slab;
+    event->next = NULL;
     
-    return pool;
+    return event;
 }
 
-void goon_pool_destroy(goon_pool_t *pool) {
-    if (!pool) return;
+goon_event_t* goon_event_create_sym(goon_symbol_t sym, goon_priority_t priority) {
+    return goon_event_alloc(NULL, sym, priority);
+}
+
+goon_event_t* goon_event_create(const char *name, goon_priority_t priority) {
+    goon_symbol_t sym = goon_symbol_intern(name);
+    if (sym == GOON_SYMBOL_NONE) return NULL;
+    return goon_event_create_sym(sym, priority);
+}
+
+/*
+ * Allocate from the context's event slab instead of malloc. Such events
+ * can be emitted into any context and destroyed on any thread, but must
+ * not outlive the context that created them.
+ */
+goon_event_t* goon_context_create_event_sym(goon_context_t *ctx, goon_symbol_t sym, goon_priority_t priority) {
+    if (!ctx) return NULL;
+    return goon_event_alloc(ctx->event_slab, sym, priority);
+}
+
+goon_event_t* goon_context_create_event(goon_context_t *ctx, const char *name, goon_priority_t priority) {
+    if (!ctx) return NULL;
+    goon_symbol_t sym = goon_symbol_intern(name);
+    if (sym == GOON_SYMBOL_NONE) return NULL;
+    return goon_event_alloc(ctx->event_slab, sym, priority);
+}
+
+const char* goon_event_get_name(const goon_event_t *event) {
+    return event ? goon_symbol_name(event->sym) : NULL;
+}
+
+uint32_t goon_event_get_id(const goon_event_t *event) {
+    return event ? event->id : 0;
+}
+
+goon_priority_t goon_event_get_priority(const goon_event_t *event) {
+    return event ? (goon_priority_t)event->priority : GOON_PRIORITY_LOW;
+}
+
+int goon_event_set_priority(goon_event_t *event, goon_priority_t priority) {
+    if (!event) return GOON_ERROR_NULL_PTR;
+    event->priority = (uint8_t)priority;
+    return GOON_SUCCESS;
+}
+
+// Wall-clock creation time in seconds, as time(NULL) reports it
+time_t goon_event_get_timestamp(const goon_event_t *event) {
+    return event ? (time_t)(event->timestamp_ns / 1000000000ull) : 0;
+}
+
+uint64_t goon_event_get_timestamp_ns(const goon_event_t *event) {
+    return event ? event->timestamp_ns : 0;
+}
+
+void* goon_event_get_user_data(const goon_event_t *event) {
+    return event ? event->user_data : NULL;
+}
+
+int goon_event_set_user_data(goon_event_t *event, void *user_data) {
+    if (!event) return GOON_ERROR_NULL_PTR;
+    event->user_data = user_data;
+    return GOON_SUCCESS;
+}
+
+void goon_event_destroy(goon_event_t *event) {
+    if (!event) return;
     
-    for (size_t i = 0; i < pool->size; i++) {
-        if (pool->objects[i]) {
-            pool->free(pool->objects[i]);
-        }
+    if (event->data) {
+        goon_data_destroy(event->data);
     }
     
-    if (pool->objects) free(pool->objects);
-    if (pool->in_use) free(pool->in_use);
-    free(pool);
+    if (event->slab) {
+        goon_event_slab_free(event->slab, event);
+    } else if (event->in_arena) {
+        goon_arena_put(event);
+    } else {
+        free(event);
+    }
 }
 
-void* goon_pool_acquire(goon_pool_t *pool, size_t size) {
-    if (!pool) return NULL;
-    
-    // Check for available object
-    for (size_t i = 0; i < pool->size; i++) {
-        if (!pool->in_use[i] && pool->objects[i]) {
-            pool->in_use[i] = true;
-            return pool->objects[i];
-        }
+// Heap copy of an arena event; an arena payload is copied, any other is shared
+static goon_event_t* goon_event_promote_copy(goon_event_t *event) {
+    goon_event_t *copy = (goon_event_t*)aligned_alloc(GOON_CACHE_LINE, GOON_CACHE_LINE);
+    if (!copy) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_event_t");
+        return NULL;
     }
     
-    // Allocate new object
-    if (pool->size < pool->capacity) {
-        void *obj = pool->alloc(size);
-        if (!obj) {
-            GOON_ERROR_LOG("Failed to allocate object from pool");
+    *copy = *event;
+    copy->in_arena = false;
+    copy->next = NULL;
+    
+    if (event->data && event->data->mode == GOON_DATA_ARENA) {
+        copy->data = goon_data_create_in(NULL, event->data->type, event->data->value, event->data->size);
+        if (!copy->data) {
+            free(copy);
             return NULL;
         }
-        
-        pool->objects[pool->size] = obj;
-        pool->in_use[pool->size] = true;
-        pool->size++;
-        return obj;
     }
     
-    GOON_WARN("Pool is full, cannot acquire object");
-    return NULL;
+    return copy;
 }
 
-int goon_pool_release(goon_pool_t *pool, void *obj) {
-    if (!pool || !obj) return GOON_ERROR_NULL_PTR;
+// Keep one of an event and its promoted copy, releasing the other
+static void goon_event_promote_finish(goon_event_t *event, goon_event_t *copy, bool keep_copy) {
+    bool shared_data = copy->data == event->data;
     
-    for (size_t i = 0; i < pool->size; i++) {
-        if (pool->objects[i] == obj) {
-            pool->in_use[i] = false;
-            return GOON_SUCCESS;
-        }
+    if (keep_copy) {
+        if (shared_data) event->data = NULL;
+        goon_event_destroy(event);
+    } else {
+        if (!shared_data) goon_data_destroy(copy->data);
+        free(copy);
     }
-    
-    return GOON_ERROR_NOT_FOUND;
 }
 
-/* ============================================================================
- * HANDLER MANAGEMENT FUNCTIONS
- * ============================================================================ */
-
-goon_handler_t* goon_handler_create(const char *name, goon_handler_func func, void *user_data) {
-    if (!name || !func) {
-        GOON_ERROR_LOG("Invalid parameters for handler creation");
-        return NULL;
-    }
-    
-    goon_handler_t *handler = (goon_handler_t*)malloc(sizeof(goon_handler_t));
-    if (!handler) {
-        GOON_ERROR_LOG("Failed to allocate memory for goon_handler_t");
-        return NULL;
-    }
+/*
+ * Move an arena event, and its payload, to the heap so it can outlive the
+ * tick it was created in. Returns the heap event and destroys the arena
+ * one, or returns NULL and leaves `event` untouched. Other events are
+ * returned as is. Only promote events that have not been emitted yet.
+ */
+goon_event_t* goon_event_promote(goon_event_t *event) {
+    if (!event || !event->in_arena) return event;
     
-    handler->id = g_next_handler_id++;
-    strncpy(handler->name, name, GOON_MAX_NAME_LEN - 1);
-    handler->name[GOON_MAX_NAME_LEN - 1] = '\0';
-    handler->func = func;
-    handler->user_data = user_data;
-    handler->enabled = true;
-    handler->call_count = 0;
-    handler->error_count = 0;
-    handler->avg_exec_time = 0.0;
-    handler->next = NULL;
+    goon_event_t *copy = goon_event_promote_copy(event);
+    if (!copy) return NULL;
     
-    return handler;
-}
-
-void goon_handler_destroy(goon_handler_t *handler) {
-    if (!handler) return;
-    free(handler);
+    goon_event_promote_finish(event, copy, true);
+    return copy;
 }
 
-int goon_handler_enable(goon_handler_t *handler) {
-    if (!handler) return GOON_ERROR_NULL_PTR;
-    handler->enabled = true;
+int goon_event_set_data(goon_event_t *event, goon_data_t *data) {
+    if (!event) return GOON_ERROR_NULL_PTR;
+    
+    if (event->data) {
+        goon_data_destroy(event->data);
+    }
+    
+    event->data = data;
     return GOON_SUCCESS;
 }
 
-int goon_handler_disable(goon_handler_t *handler) {
-    if (!handler) return GOON_ERROR_NULL_PTR;
-    handler->enabled = false;
-    return GOON_SUCCESS;
+goon_data_t* goon_event_get_data(goon_event_t *event) {
+    if (!event) return NULL;
+    return event->data;
 }
 
-bool goon_handler_is_enabled(goon_handler_t *handler) {
-    if (!handler) return false;
-    return handler->enabled;
+goon_event_t* goon_event_clone(goon_event_t *event) {
+    if (!event) return NULL;
+    
+    goon_event_t *copy = goon_event_alloc(event->slab, event->sym, (goon_priority_t)event->priority);
+    if (!copy) return NULL;
+    
+    copy->user_data = event->user_data;
+    
+    if (event->data) {
+        goon_data_t *data = goon_data_clone(event->data);
+        if (!data) {
+            goon_event_destroy(copy);
+            return NULL;
+        }
+        copy->data = data;
+    }
+    
+    return copy;
 }
 
 /* ============================================================================
- * CONTEXT MANAGEMENT FUNCTIONS
+ * QUEUE MANAGEMENT FUNCTIONS
  * ============================================================================ */
 
-goon_context_t* goon_context_create(const char *name) {
-    goon_context_t *ctx = (goon_context_t*)malloc(sizeof(goon_context_t));
-    if (!ctx) {
-        GOON_ERROR_LOG("Failed to allocate memory for goon_context_t");
-        return NULL;
-    }
-    
-    ctx->id = g_next_context_id++;
-    strncpy(ctx->name, name ? name : "default", GOON_MAX_NAME_LEN - 1);
-    ctx->name[GOON_MAX_NAME_LEN - 1] = '\0';
-    ctx->state = GOON_STATE_IDLE;
-    ctx->handlers = NULL;
-    ctx->handler_count = 0;
-    ctx->event_queue = goon_queue_create(GOON_MAX_QUEUE_SIZE);
-    ctx->call_stack = goon_stack_create(GOON_MAX_STACK_SIZE);
-    ctx->cache = goon_cache_create();
-    ctx->memory_pool = goon_pool_create(GOON_POOL_SIZE, NULL, NULL);
-    ctx->event_count = 0;
-    ctx->total_events_processed = 0;
-    ctx->start_time = time(NULL);
-    ctx->user_data = NULL;
-    ctx->debug_mode = false;
-    
-    if (!ctx->event_queue || !ctx->call_stack || !ctx->cache || !ctx->memory_pool) {
-        GOON_ERROR_LOG("Failed to initialize context components");
-        goon_context_destroy(ctx);
-        return NULL;
+static size_t goon_next_pow2(size_t n) {
+    size_t p = 1;
+    while (p < n) {
+        p <<= 1;
     }
-    
-    return ctx;
+    return p;
 }
 
-void goon_context_destroy(goon_context_t *ctx) {
-    if (!ctx) return;
-    
-    goon_handler_t *handler = ctx->handlers;
-    while (handler) {
-        goon_handler_t *next = handler->next;
-        goon_handler_destroy(handler);
-        handler = next;
+void goon_queue_destroy(goon_queue_t *queue);
+
+goon_queue_t* goon_queue_create_lanes(size_t max_size, goon_queue_mode_t lane_mode,
+                                      goon_drain_policy_t policy) {
+    if (lane_mode == GOON_QUEUE_MODE_LANES) {
+        GOON_ERROR_LOG("Priority lanes cannot be nested");
+        return NULL;
     }
     
-    if (ctx->event_queue) {
-        goon_queue_destroy(ctx->event_queue);
+    goon_queue_mode_t mode = policy == GOON_DRAIN_FIFO ? lane_mode : GOON_QUEUE_MODE_LANES;
+    goon_queue_t *queue = (goon_queue_t*)malloc(sizeof(goon_queue_t));
+    if (!queue) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_queue_t");
+        return NULL;
     }
     
-    if (ctx->call_stack) {
-        goon_stack_destroy(ctx->call_stack);
+    queue->mode = mode;
+    queue->head = NULL;
+    queue->tail = NULL;
+    queue->size = 0;
+    queue->max_size = max_size > 0 ? max_size : GOON_MAX_QUEUE_SIZE;
+    queue->slots = NULL;
+    queue->mask = 0;
+    atomic_init(&queue->enqueue_pos, 0);
+    atomic_init(&queue->dequeue_pos, 0);
+    atomic_init(&queue->lane_count, 0);
+    queue->drain_policy = GOON_DRAIN_FIFO;
+    queue->aging_limit = GOON_LANE_AGING_LIMIT;
+    queue->seg_head = NULL;
+    queue->seg_tail = NULL;
+    queue->seg_read = 0;
+    queue->seg_write = 0;
+    queue->seg_free = NULL;
+    queue->seg_free_count = 0;
+    queue->seg_allocated = 0;
+    queue->memory_limit = 0;
+    
+    // Segmented queues are bounded by memory_limit, not by a count
+    if (lane_mode == GOON_QUEUE_MODE_SEGMENTED) {
+        queue->max_size = SIZE_MAX;
     }
     
-    if (ctx->cache) {
-        goon_cache_destroy(ctx->cache);
+    for (int i = 0; i < GOON_PRIORITY_COUNT; i++) {
+        queue->lanes[i] = NULL;
+        queue->lane_weights[i] = 1u << i;
+        atomic_init(&queue->lane_credits[i], queue->lane_weights[i]);
+        atomic_init(&queue->lane_skips[i], 0);
     }
     
-    if (ctx->memory_pool) {
-        goon_pool_destroy(ctx->memory_pool);
+    if (mode == GOON_QUEUE_MODE_LANES) {
+        // Lanes share max_size through lane_count; each lane can hold all of it
+        for (int i = 0; i < GOON_PRIORITY_COUNT; i++) {
+            queue->lanes[i] = goon_queue_create_lanes(queue->max_size, lane_mode, GOON_DRAIN_FIFO);
+            if (!queue->lanes[i]) {
+                for (int j = 0; j < i; j++) {
+                    goon_queue_destroy(queue->lanes[j]);
+                }
+                free(queue);
+                return NULL;
+            }
+        }
+        
+        queue->drain_policy = policy;
+    } else if (mode == GOON_QUEUE_MODE_RING) {
+        // Ring capacity must be a power of two so slot lookup is a mask
+        size_t capacity = goon_next_pow2(queue->max_size);
+        queue->slots = (goon_ring_slot_t*)malloc(capacity * sizeof(goon_ring_slot_t));
+        if (!queue->slots) {
+            GOON_ERROR_LOG("Failed to allocate memory for ring slots");
+            free(queue);
+            return NULL;
+        }
+        
+        for (size_t i = 0; i < capacity; i++) {
+            atomic_init(&queue->slots[i].sequence, i);
+            queue->slots[i].event = NULL;
+        }
+        
+        queue->max_size = capacity;
+        queue->mask = capacity - 1;
     }
     
-    free(ctx);
+    return queue;
 }
 
-int goon_context_register_handler(goon_context_t *ctx, goon_handler_t *handler) {
-    if (!ctx || !handler) return GOON_ERROR_NULL_PTR;
+goon_queue_t* goon_queue_create_ex(size_t max_size, goon_queue_mode_t mode) {
+    if (mode == GOON_QUEUE_MODE_LANES) {
+        return goon_queue_create_lanes(max_size, GOON_QUEUE_MODE_LIST, GOON_DRAIN_STRICT);
+    }
+    return goon_queue_create_lanes(max_size, mode, GOON_DRAIN_FIFO);
+}
+
+goon_queue_t* goon_queue_create(size_t max_size) {
+    return goon_queue_create_ex(max_size, GOON_QUEUE_MODE_LIST);
+}
+
+static int goon_ring_push(goon_queue_t *queue, goon_event_t *event) {
+    goon_ring_slot_t *slot;
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
     
-    handler->next = ctx->handlers;
-    ctx->handlers = handler;
-    ctx->handler_count++;
+    for (;;) {
+        slot = &queue->slots[pos & queue->mask];
+        size_t seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Slot still holds an event from the previous lap: ring is full
+            return GOON_ERROR_OVERFLOW;
+        } else {
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+        }
+    }
     
-    GOON_INFO("Registered handler '%s' (ID: %u)", handler->name, handler->id);
+    slot->event = event;
+    atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
     return GOON_SUCCESS;
 }
 
-goon_handler_t* goon_context_find_handler(goon_context_t *ctx, const char *name) {
-    if (!ctx || !name) return NULL;
+static goon_event_t* goon_ring_pop(goon_queue_t *queue) {
+    goon_ring_slot_t *slot;
+    size_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
     
-    goon_handler_t *handler = ctx->handlers;
-    while (handler) {
-        if (strcmp(handler->name, name) == 0) {
-            return handler;
+    for (;;) {
+        slot = &queue->slots[pos & queue->mask];
+        size_t seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return NULL;
+        } else {
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
         }
-        handler = handler->next;
     }
     
-    return NULL;
+    goon_event_t *event = slot->event;
+    slot->event = NULL;
+    // Hand the slot to the producer one lap ahead
+    atomic_store_explicit(&slot->sequence, pos + queue->mask + 1, memory_order_release);
+    return event;
 }
 
-int goon_context_unregister_handler(goon_context_t *ctx, const char *name) {
-    if (!ctx || !name) return GOON_ERROR_NULL_PTR;
+static int goon_ring_push_batch(goon_queue_t *queue, goon_event_t *head, size_t count) {
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
     
-    goon_handler_t *prev = NULL;
-    goon_handler_t *handler = ctx->handlers;
+    // Claim `count` consecutive positions in one CAS, provided every one of
+    // them is within a lap of the consumers
+    for (;;) {
+        size_t deq = atomic_load_explicit(&queue->dequeue_pos, memory_order_acquire);
+        if (pos + count - deq > queue->mask + 1) {
+            return GOON_ERROR_OVERFLOW;
+        }
+        
+        if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + count,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+            break;
+        }
+    }
     
+    goon_event_t *event = head;
+    for (size_t i = 0; i < count; i++) {
+        goon_ring_slot_t *slot = &queue->slots[(pos + i) & queue->mask];
+        goon_event_t *next = event->next;
+        
+        // A consumer may still be finishing with the previous lap's event
+        while (atomic_load_explicit(&slot->sequence, memory_order_acquire) != pos + i) {
+        }
+        
+        event->next = NULL;
+        slot->event = event;
+        atomic_store_explicit(&slot->sequence, pos + i + 1, memory_order_release);
+        event = next;
+    }
+    
+    return GOON_SUCCESS;
+}
+
+static size_t goon_ring_size(goon_queue_t *queue) {
+    size_t deq = atomic_load_explicit(&queue->dequeue_pos, memory_order_acquire);
+    size_t enq = atomic_load_explicit(&queue->enqueue_pos, memory_order_acquire);
+    
+    // Snapshot is racy under concurrent use; clamp to the valid range
+    if (enq <= deq) return 0;
+    if (enq - deq > queue->max_size) return queue->max_size;
+    return enq - deq;
+}
+
+static goon_segment_t* goon_segment_acquire(goon_queue_t *queue) {
+    goon_segment_t *segment = queue->seg_free;
+    
+    if (segment) {
+        queue->seg_free = segment->next;
+        queue->seg_free_count--;
+    } else {
+        segment = (goon_segment_t*)aligned_alloc(GOON_SEGMENT_BYTES, sizeof(goon_segment_t));
+        if (!segment) return NULL;
+        queue->seg_allocated++;
+    }
+    
+    segment->next = NULL;
+    return segment;
+}
+
+static void goon_segment_recycle(goon_queue_t *queue, goon_segment_t *segment) {
+    if (queue->seg_free_count < GOON_SEGMENT_FREE_MAX) {
+        segment->next = queue->seg_free;
+        queue->seg_free = segment;
+        queue->seg_free_count++;
+        return;
+    }
+    
+    free(segment);
+    queue->seg_allocated--;
+}
+
+static int goon_segmented_push(goon_queue_t *queue, goon_event_t *event) {
+    if (!queue->seg_tail || queue->seg_write == GOON_SEGMENT_EVENTS) {
+        goon_segment_t *segment = goon_segment_acquire(queue);
+        if (!segment) {
+            GOON_ERROR_LOG("Failed to allocate queue segment");
+            return GOON_ERROR_OUT_OF_MEMORY;
+        }
+        
+        if (queue->seg_tail) {
+            queue->seg_tail->next = segment;
+        } else {
+            queue->seg_head = segment;
+            queue->seg_read = 0;
+        }
+        queue->seg_tail = segment;
+        queue->seg_write = 0;
+    }
+    
+    queue->seg_tail->events[queue->seg_write++] = event;
+    queue->size++;
+    return GOON_SUCCESS;
+}
+
+static goon_event_t* goon_segmented_pop(goon_queue_t *queue) {
+    if (queue->size == 0) return NULL;
+    
+    if (queue->seg_read == GOON_SEGMENT_EVENTS) {
+        goon_segment_t *drained = queue->seg_head;
+        queue->seg_head = drained->next;
+        queue->seg_read = 0;
+        goon_segment_recycle(queue, drained);
+    }
+    
+    goon_event_t *event = queue->seg_head->events[queue->seg_read++];
+    queue->size--;
+    
+    // Rewind a drained single segment so it is reused from the start
+    if (queue->size == 0) {
+        queue->seg_read = 0;
+        queue->seg_write = 0;
+    }
+    
+    return event;
+}
+
+static size_t goon_segmented_pop_batch(goon_queue_t *queue, goon_event_t **events, size_t max_events) {
+    size_t count = 0;
+    
+    while (count < max_events && queue->size > 0) {
+        if (queue->seg_read == GOON_SEGMENT_EVENTS) {
+            goon_segment_t *drained = queue->seg_head;
+            queue->seg_head = drained->next;
+            queue->seg_read = 0;
+            goon_segment_recycle(queue, drained);
+        }
+        
+        // Copy the contiguous run left in the head segment
+        size_t end = queue->seg_head == queue->seg_tail ? queue->seg_write : GOON_SEGMENT_EVENTS;
+        size_t run = end - queue->seg_read;
+        if (run > max_events - count) run = max_events - count;
+        
+        memcpy(&events[count], &queue->seg_head->events[queue->seg_read], run * sizeof(goon_event_t*));
+        queue->seg_read += run;
+        queue->size -= run;
+        count += run;
+    }
+    
+    if (queue->size == 0) {
+        queue->seg_read = 0;
+        queue->seg_write = 0;
+    }
+    
+    return count;
+}
+
+size_t goon_queue_memory_usage(goon_queue_t *queue);
+
+int goon_queue_try_push(goon_queue_t *queue, goon_event_t *event);
+int goon_queue_push_batch(goon_queue_t *queue, goon_event_t *head, goon_event_t *tail, size_t count);
+goon_event_t* goon_queue_pop(goon_queue_t *queue);
+size_t goon_queue_size(goon_queue_t *queue);
+
+static int goon_lane_index(goon_priority_t priority) {
+    if ((int)priority < GOON_PRIORITY_LOW) return GOON_PRIORITY_LOW;
+    if ((int)priority > GOON_PRIORITY_CRITICAL) return GOON_PRIORITY_CRITICAL;
+    return (int)priority;
+}
+
+static int goon_lanes_select(goon_queue_t *queue) {
+    // Aging guard: a lane passed over too many times is served first,
+    // lowest priority first, so LOW events cannot starve
+    for (int i = 0; i < GOON_PRIORITY_COUNT; i++) {
+        if (atomic_load_explicit(&queue->lane_skips[i], memory_order_relaxed) >= queue->aging_limit &&
+            goon_queue_size(queue->lanes[i]) > 0) {
+            return i;
+        }
+    }
+    
+    if (queue->drain_policy == GOON_DRAIN_WEIGHTED) {
+        // Each lane may pop up to its weight per round; refill once every
+        // non-empty lane has spent its credits
+        for (int pass = 0; pass < 2; pass++) {
+            bool pending = false;
+            for (int i = GOON_PRIORITY_COUNT - 1; i >= 0; i--) {
+                if (goon_queue_size(queue->lanes[i]) == 0) continue;
+                pending = true;
+                if (atomic_load_explicit(&queue->lane_credits[i], memory_order_relaxed) > 0) return i;
+            }
+            
+            if (!pending) return -1;
+            
+            for (int i = 0; i < GOON_PRIORITY_COUNT; i++) {
+                atomic_store_explicit(&queue->lane_credits[i], queue->lane_weights[i], memory_order_relaxed);
+            }
+        }
+        return -1;
+    }
+    
+    for (int i = GOON_PRIORITY_COUNT - 1; i >= 0; i--) {
+        if (goon_queue_size(queue->lanes[i]) > 0) return i;
+    }
+    
+    return -1;
+}
+
+static goon_event_t* goon_lanes_pop(goon_queue_t *queue) {
+    int lane = goon_lanes_select(queue);
+    if (lane < 0) return NULL;
+    
+    goon_event_t *event = goon_queue_pop(queue->lanes[lane]);
+    if (!event) {
+        // Lost a race with another consumer; fall back to any lane
+        for (int i = GOON_PRIORITY_COUNT - 1; i >= 0 && !event; i--) {
+            event = goon_queue_pop(queue->lanes[i]);
+            lane = i;
+        }
+        if (!event) return NULL;
+    }
+    
+    atomic_fetch_sub_explicit(&queue->lane_count, 1, memory_order_release);
+    
+    // Another consumer may have spent the last credit or refilled meanwhile
+    uint32_t credits = atomic_load_explicit(&queue->lane_credits[lane], memory_order_relaxed);
+    while (credits > 0 &&
+           !atomic_compare_exchange_weak_explicit(&queue->lane_credits[lane], &credits, credits - 1,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+    
+    atomic_store_explicit(&queue->lane_skips[lane], 0, memory_order_relaxed);
+    for (int i = 0; i < GOON_PRIORITY_COUNT; i++) {
+        if (i != lane && goon_queue_size(queue->lanes[i]) > 0) {
+            atomic_fetch_add_explicit(&queue->lane_skips[i], 1, memory_order_relaxed);
+        }
+    }
+    
+    return event;
+}
+
+void goon_queue_destroy(goon_queue_t *queue) {
+    if (!queue) return;
+    
+    if (queue->mode == GOON_QUEUE_MODE_SEGMENTED) {
+        goon_event_t *event;
+        while ((event = goon_segmented_pop(queue)) != NULL) {
+            goon_event_destroy(event);
+        }
+        
+        goon_segment_t *lists[2] = {queue->seg_head, queue->seg_free};
+        for (int i = 0; i < 2; i++) {
+            goon_segment_t *segment = lists[i];
+            while (segment) {
+                goon_segment_t *next = segment->next;
+                free(segment);
+                segment = next;
+            }
+        }
+        free(queue);
+        return;
+    }
+    
+    if (queue->mode == GOON_QUEUE_MODE_LANES) {
+        for (int i = 0; i < GOON_PRIORITY_COUNT; i++) {
+            goon_queue_destroy(queue->lanes[i]);
+        }
+        free(queue);
+        return;
+    }
+    
+    if (queue->mode == GOON_QUEUE_MODE_RING) {
+        goon_event_t *event;
+        while ((event = goon_ring_pop(queue)) != NULL) {
+            goon_event_destroy(event);
+        }
+        free(queue->slots);
+        free(queue);
+        return;
+    }
+    
+    goon_event_t *current = queue->head;
+    while (current) {
+        goon_event_t *next = current->next;
+        goon_event_destroy(current);
+        current = next;
+    }
+    
+    free(queue);
+}
+
+static int goon_lanes_push(goon_queue_t *queue, goon_event_t *event) {
+    // Reserve a unit of the shared capacity before touching the lane
+    size_t count = atomic_fetch_add_explicit(&queue->lane_count, 1, memory_order_acq_rel);
+    if (count >= queue->max_size ||
+        (queue->memory_limit && goon_queue_memory_usage(queue) >= queue->memory_limit)) {
+        atomic_fetch_sub_explicit(&queue->lane_count, 1, memory_order_release);
+        return GOON_ERROR_OVERFLOW;
+    }
+    
+    int result = goon_queue_try_push(queue->lanes[goon_lane_index(event->priority)], event);
+    if (result != GOON_SUCCESS) {
+        atomic_fetch_sub_explicit(&queue->lane_count, 1, memory_order_release);
+    }
+    
+    return result;
+}
+
+int goon_queue_try_push(goon_queue_t *queue, goon_event_t *event) {
+    if (!queue || !event) return GOON_ERROR_NULL_PTR;
+    
+    event->next = NULL;
+    
+    if (queue->mode == GOON_QUEUE_MODE_LANES) return goon_lanes_push(queue, event);
+    if (queue->mode == GOON_QUEUE_MODE_RING) return goon_ring_push(queue, event);
+    
+    if (queue->mode == GOON_QUEUE_MODE_SEGMENTED) {
+        // Soft limit: checked before the push, so one segment may overshoot
+        if (queue->memory_limit && goon_queue_memory_usage(queue) >= queue->memory_limit) {
+            return GOON_ERROR_OVERFLOW;
+        }
+        return goon_segmented_push(queue, event);
+    }
+    
+    if (queue->size >= queue->max_size) {
+        return GOON_ERROR_OVERFLOW;
+    }
+    
+    if (queue->tail) {
+        queue->tail->next = event;
+    } else {
+        queue->head = event;
+    }
+    
+    queue->tail = event;
+    queue->size++;
+    
+    return GOON_SUCCESS;
+}
+
+int goon_queue_push(goon_queue_t *queue, goon_event_t *event) {
+    int result = goon_queue_try_push(queue, event);
+    if (result == GOON_ERROR_OVERFLOW) {
+        GOON_WARN("Queue is full, cannot push event");
+    }
+    return result;
+}
+
+// Stock the free list so `count` more pushes cannot fail halfway
+static int goon_segmented_reserve(goon_queue_t *queue, size_t count) {
+    size_t room = queue->seg_tail ? GOON_SEGMENT_EVENTS - queue->seg_write : 0;
+    while (room + queue->seg_free_count * GOON_SEGMENT_EVENTS < count) {
+        goon_segment_t *segment = (goon_segment_t*)aligned_alloc(GOON_SEGMENT_BYTES,
+                                                                 sizeof(goon_segment_t));
+        if (!segment) return GOON_ERROR_OUT_OF_MEMORY;
+        
+        queue->seg_allocated++;
+        segment->next = queue->seg_free;
+        queue->seg_free = segment;
+        queue->seg_free_count++;
+    }
+    
+    return GOON_SUCCESS;
+}
+
+static int goon_lanes_push_batch(goon_queue_t *queue, goon_event_t *head, size_t count) {
+    size_t reserved = atomic_fetch_add_explicit(&queue->lane_count, count, memory_order_acq_rel);
+    if (reserved + count > queue->max_size ||
+        (queue->memory_limit && goon_queue_memory_usage(queue) >= queue->memory_limit)) {
+        atomic_fetch_sub_explicit(&queue->lane_count, count, memory_order_release);
+        return GOON_ERROR_OVERFLOW;
+    }
+    
+    size_t counts[GOON_PRIORITY_COUNT] = {0};
+    goon_event_t *event = head;
+    for (size_t i = 0; i < count; i++) {
+        counts[goon_lane_index(event->priority)]++;
+        event = event->next;
+    }
+    
+    // Make room in every lane before linking anything, so a failure leaves
+    // the whole chain with the caller. Ring and list lanes can each hold
+    // max_size events, so the lane_count reservation covers them.
+    for (int i = 0; i < GOON_PRIORITY_COUNT; i++) {
+        if (counts[i] > 0 && queue->lanes[i]->mode == GOON_QUEUE_MODE_SEGMENTED) {
+            int result = goon_segmented_reserve(queue->lanes[i], counts[i]);
+            if (result != GOON_SUCCESS) {
+                atomic_fetch_sub_explicit(&queue->lane_count, count, memory_order_release);
+                return result;
+            }
+        }
+    }
+    
+    // Split the chain per priority, then link each sub-chain in one step
+    goon_event_t *heads[GOON_PRIORITY_COUNT] = {NULL};
+    goon_event_t *tails[GOON_PRIORITY_COUNT] = {NULL};
+    
+    event = head;
+    for (size_t i = 0; i < count; i++) {
+        goon_event_t *next = event->next;
+        int lane = goon_lane_index(event->priority);
+        
+        event->next = NULL;
+        if (tails[lane]) {
+            tails[lane]->next = event;
+        } else {
+            heads[lane] = event;
+        }
+        tails[lane] = event;
+        event = next;
+    }
+    
+    for (int i = 0; i < GOON_PRIORITY_COUNT; i++) {
+        if (counts[i] > 0) {
+            goon_queue_push_batch(queue->lanes[i], heads[i], tails[i], counts[i]);
+        }
+    }
+    
+    return GOON_SUCCESS;
+}
+
+/*
+ * Push a pre-linked chain of `count` events (head..tail via ->next). The
+ * batch is all-or-nothing: on GOON_ERROR_OVERFLOW or
+ * GOON_ERROR_OUT_OF_MEMORY nothing was queued and the caller still owns
+ * the chain.
+ */
+int goon_queue_push_batch(goon_queue_t *queue, goon_event_t *head, goon_event_t *tail, size_t count) {
+    if (!queue || !head || !tail) return GOON_ERROR_NULL_PTR;
+    if (count == 0) return GOON_ERROR_INVALID_PARAM;
+    
+    if (queue->mode == GOON_QUEUE_MODE_LANES) return goon_lanes_push_batch(queue, head, count);
+    if (queue->mode == GOON_QUEUE_MODE_RING) return goon_ring_push_batch(queue, head, count);
+    
+    if (queue->mode == GOON_QUEUE_MODE_SEGMENTED) {
+        if (queue->memory_limit && goon_queue_memory_usage(queue) >= queue->memory_limit) {
+            return GOON_ERROR_OVERFLOW;
+        }
+        
+        int result = goon_segmented_reserve(queue, count);
+        if (result != GOON_SUCCESS) return result;
+        
+        goon_event_t *event = head;
+        for (size_t i = 0; i < count; i++) {
+            goon_event_t *next = event->next;
+            event->next = NULL;
+            goon_segmented_push(queue, event);
+            event = next;
+        }
+        return GOON_SUCCESS;
+    }
+    
+    if (queue->size + count > queue->max_size) {
+        return GOON_ERROR_OVERFLOW;
+    }
+    
+    tail->next = NULL;
+    if (queue->tail) {
+        queue->tail->next = head;
+    } else {
+        queue->head = head;
+    }
+    
+    queue->tail = tail;
+    queue->size += count;
+    
+    return GOON_SUCCESS;
+}
+
+goon_event_t* goon_queue_pop(goon_queue_t *queue) {
+    if (!queue) return NULL;
+    
+    if (queue->mode == GOON_QUEUE_MODE_LANES) {
+        return goon_lanes_pop(queue);
+    }
+    
+    if (queue->mode == GOON_QUEUE_MODE_RING) {
+        return goon_ring_pop(queue);
+    }
+    
+    if (queue->mode == GOON_QUEUE_MODE_SEGMENTED) {
+        return goon_segmented_pop(queue);
+    }
+    
+    if (!queue->head) return NULL;
+    
+    goon_event_t *event = queue->head;
+    queue->head = event->next;
+    
+    if (!queue->head) {
+        queue->tail = NULL;
+    }
+    
+    event->next = NULL;
+    queue->size--;
+    
+    return event;
+}
+
+size_t goon_queue_pop_batch(goon_queue_t *queue, goon_event_t **events, size_t max_events) {
+    if (!queue || !events) return 0;
+    
+    size_t count = 0;
+    
+    if (queue->mode == GOON_QUEUE_MODE_LIST) {
+        goon_event_t *event = queue->head;
+        while (event && count < max_events) {
+            goon_event_t *next = event->next;
+            event->next = NULL;
+            events[count++] = event;
+            event = next;
+        }
+        
+        queue->head = event;
+        if (!queue->head) {
+            queue->tail = NULL;
+        }
+        queue->size -= count;
+        return count;
+    }
+    
+    if (queue->mode == GOON_QUEUE_MODE_SEGMENTED) {
+        return goon_segmented_pop_batch(queue, events, max_events);
+    }
+    
+    while (count < max_events) {
+        goon_event_t *event = goon_queue_pop(queue);
+        if (!event) break;
+        events[count++] = event;
+    }
+    
+    return count;
+}
+
+size_t goon_queue_size(goon_queue_t *queue) {
+    if (!queue) return 0;
+    if (queue->mode == GOON_QUEUE_MODE_RING) return goon_ring_size(queue);
+    
+    if (queue->mode == GOON_QUEUE_MODE_LANES) {
+        return atomic_load_explicit(&queue->lane_count, memory_order_acquire);
+    }
+    
+    return queue->size;
+}
+
+size_t goon_queue_memory_usage(goon_queue_t *queue) {
+    if (!queue) return 0;
+    
+    size_t usage = sizeof(goon_queue_t);
+    
+    switch (queue->mode) {
+        case GOON_QUEUE_MODE_LANES:
+            for (int i = 0; i < GOON_PRIORITY_COUNT; i++) {
+                usage += goon_queue_memory_usage(queue->lanes[i]);
+            }
+            return usage;
+            
+        case GOON_QUEUE_MODE_RING:
+            usage += (queue->mask + 1) * sizeof(goon_ring_slot_t);
+            break;
+            
+        case GOON_QUEUE_MODE_SEGMENTED:
+            usage += queue->seg_allocated * sizeof(goon_segment_t);
+            break;
+            
+        case GOON_QUEUE_MODE_LIST:
+        default:
+            break;
+    }
+    
+    // Payloads are not counted: the limit tracks queue-owned memory only
+    return usage + goon_queue_size(queue) * sizeof(goon_event_t);
+}
+
+int goon_queue_set_memory_limit(goon_queue_t *queue, size_t bytes) {
+    if (!queue) return GOON_ERROR_NULL_PTR;
+    queue->memory_limit = bytes;
+    return GOON_SUCCESS;
+}
+
+bool goon_queue_is_empty(goon_queue_t *queue) {
+    if (!queue) return true;
+    return goon_queue_size(queue) == 0;
+}
+
+goon_queue_mode_t goon_queue_get_mode(goon_queue_t *queue) {
+    if (!queue) return GOON_QUEUE_MODE_LIST;
+    return queue->mode;
+}
+
+static goon_event_t* goon_list_remove_lowest(goon_queue_t *queue, goon_priority_t incoming) {
+    goon_event_t *prev = NULL;
+    goon_event_t *victim_prev = NULL;
+    goon_event_t *victim = NULL;
+    
+    for (goon_event_t *cur = queue->head; cur; prev = cur, cur = cur->next) {
+        if (!victim || cur->priority < victim->priority) {
+            victim = cur;
+            victim_prev = prev;
+        }
+    }
+    
+    if (!victim || victim->priority > incoming) return NULL;
+    
+    if (victim_prev) {
+        victim_prev->next = victim->next;
+    } else {
+        queue->head = victim->next;
+    }
+    
+    if (queue->tail == victim) {
+        queue->tail = victim_prev;
+    }
+    
+    victim->next = NULL;
+    queue->size--;
+    return victim;
+}
+
+/*
+ * Remove one queued event to make room for `incoming`. DROP_OLDEST takes
+ * the oldest event at the incoming priority (or the lowest non-empty lane);
+ * DROP_LOWEST takes the lowest-priority event, provided it does not outrank
+ * the incoming one. Returns NULL when nothing should be evicted.
+ */
+goon_event_t* goon_queue_evict(goon_queue_t *queue, goon_overflow_policy_t policy,
+                               goon_priority_t incoming) {
+    if (!queue) return NULL;
+    
+    if (queue->mode == GOON_QUEUE_MODE_LANES) {
+        int lane = goon_lane_index(incoming);
+        
+        if (policy == GOON_OVERFLOW_DROP_OLDEST && goon_queue_size(queue->lanes[lane]) > 0) {
+            goon_event_t *event = goon_queue_pop(queue->lanes[lane]);
+            if (event) atomic_fetch_sub_explicit(&queue->lane_count, 1, memory_order_release);
+            return event;
+        }
+        
+        for (int i = 0; i <= lane; i++) {
+            goon_event_t *event = goon_queue_pop(queue->lanes[i]);
+            if (event) {
+                atomic_fetch_sub_explicit(&queue->lane_count, 1, memory_order_release);
+                return event;
+            }
+        }
+        
+        return NULL;
+    }
+    
+    if (policy == GOON_OVERFLOW_DROP_LOWEST && queue->mode == GOON_QUEUE_MODE_LIST) {
+        return goon_list_remove_lowest(queue, incoming);
+    }
+    
+    // A ring cannot unlink from the middle, so it always evicts its head
+    return goon_queue_pop(queue);
+}
+
+size_t goon_queue_lane_size(goon_queue_t *queue, goon_priority_t priority) {
+    if (!queue || queue->mode != GOON_QUEUE_MODE_LANES) return 0;
+    return goon_queue_size(queue->lanes[goon_lane_index(priority)]);
+}
+
+int goon_queue_set_drain_policy(goon_queue_t *queue, goon_drain_policy_t policy) {
+    if (!queue) return GOON_ERROR_NULL_PTR;
+    
+    if (queue->mode != GOON_QUEUE_MODE_LANES || policy == GOON_DRAIN_FIFO) {
+        return GOON_ERROR_INVALID_PARAM;
+    }
+    
+    queue->drain_policy = policy;
+    for (int i = 0; i < GOON_PRIORITY_COUNT; i++) {
+        atomic_store_explicit(&queue->lane_credits[i], queue->lane_weights[i], memory_order_relaxed);
+    }
+    
+    return GOON_SUCCESS;
+}
+
+int goon_queue_set_lane_weight(goon_queue_t *queue, goon_priority_t priority, uint32_t weight) {
+    if (!queue) return GOON_ERROR_NULL_PTR;
+    if (queue->mode != GOON_QUEUE_MODE_LANES || weight == 0) return GOON_ERROR_INVALID_PARAM;
+    
+    int lane = goon_lane_index(priority);
+    queue->lane_weights[lane] = weight;
+    atomic_store_explicit(&queue->lane_credits[lane], weight, memory_order_relaxed);
+    return GOON_SUCCESS;
+}
+
+int goon_queue_set_aging_limit(goon_queue_t *queue, uint32_t limit) {
+    if (!queue) return GOON_ERROR_NULL_PTR;
+    if (queue->mode != GOON_QUEUE_MODE_LANES || limit == 0) return GOON_ERROR_INVALID_PARAM;
+    
+    queue->aging_limit = limit;
+    return GOON_SUCCESS;
+}
+
+/* ============================================================================
+ * TIMER WHEEL FUNCTIONS
+ * ============================================================================ */
+
+/*
+ * Hierarchical timing wheel with 1 ms ticks: GOON_WHEEL_LEVELS levels of
+ * GOON_WHEEL_SLOTS slots each. Timers live in a flat array linked by index,
+ * so insert and cancel are O(1); a timer id carries the array index plus a
+ * generation so stale ids are rejected. Each slot is kept in scheduling
+ * order, so timers due on the same tick fire in the order they were set.
+ */
+
+uint64_t goon_time_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u;
+}
+
+goon_timer_wheel_t* goon_timer_wheel_create(void) {
+    goon_timer_wheel_t *wheel = (goon_timer_wheel_t*)malloc(sizeof(goon_timer_wheel_t));
+    if (!wheel) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_timer_wheel_t");
+        return NULL;
+    }
+    
+    wheel->timers = NULL;
+    wheel->capacity = 0;
+    wheel->free_head = GOON_TIMER_NIL;
+    wheel->active = 0;
+    wheel->current = 0;
+    wheel->origin_ms = goon_time_now_ms();
+    wheel->next_sequence = 0;
+    memset(wheel->slots, 0xff, sizeof(wheel->slots));
+    memset(wheel->tails, 0xff, sizeof(wheel->tails));
+    memset(wheel->level_count, 0, sizeof(wheel->level_count));
+    pthread_mutex_init(&wheel->lock, NULL);
+    
+    return wheel;
+}
+
+void goon_timer_wheel_destroy(goon_timer_wheel_t *wheel) {
+    if (!wheel) return;
+    
+    for (uint32_t i = 0; i < wheel->capacity; i++) {
+        if (wheel->timers[i].active) {
+            goon_event_destroy(wheel->timers[i].event);
+        }
+    }
+    
+    pthread_mutex_destroy(&wheel->lock);
+    free(wheel->timers);
+    free(wheel);
+}
+
+static uint32_t goon_timer_alloc(goon_timer_wheel_t *wheel) {
+    if (wheel->free_head == GOON_TIMER_NIL) {
+        uint32_t capacity = wheel->capacity ? wheel->capacity * 2 : 64;
+        goon_timer_t *timers = (goon_timer_t*)realloc(wheel->timers, capacity * sizeof(goon_timer_t));
+        if (!timers) return GOON_TIMER_NIL;
+        
+        for (uint32_t i = wheel->capacity; i < capacity; i++) {
+            timers[i].active = false;
+            timers[i].generation = 0;
+            timers[i].event = NULL;
+            timers[i].next = i + 1 < capacity ? i + 1 : GOON_TIMER_NIL;
+        }
+        
+        wheel->free_head = wheel->capacity;
+        wheel->timers = timers;
+        wheel->capacity = capacity;
+    }
+    
+    uint32_t index = wheel->free_head;
+    wheel->free_head = wheel->timers[index].next;
+    return index;
+}
+
+static void goon_timer_free(goon_timer_wheel_t *wheel, uint32_t index) {
+    goon_timer_t *timer = &wheel->timers[index];
+    timer->active = false;
+    timer->event = NULL;
+    timer->generation++;
+    timer->next = wheel->free_head;
+    wheel->free_head = index;
+}
+
+static void goon_timer_link(goon_timer_wheel_t *wheel, uint32_t index) {
+    goon_timer_t *timer = &wheel->timers[index];
+    uint64_t delta = timer->expires > wheel->current ? timer->expires - wheel->current : 0;
+    
+    int level = 0;
+    while (level < GOON_WHEEL_LEVELS - 1 &&
+           delta >= ((uint64_t)1 << (GOON_WHEEL_BITS * (level + 1)))) {
+        level++;
+    }
+    
+    // Anything beyond the top level parks in its furthest slot and is
+    // re-cascaded until it comes into range
+    uint64_t expires = timer->expires;
+    uint64_t top_span = (uint64_t)1 << (GOON_WHEEL_BITS * GOON_WHEEL_LEVELS);
+    if (delta >= top_span) {
+        expires = wheel->current + top_span - 1;
+    }
+    
+    uint32_t slot = (uint32_t)((expires >> (GOON_WHEEL_BITS * level)) & GOON_WHEEL_MASK);
+    
+    timer->level = (uint16_t)level;
+    timer->slot = (uint16_t)slot;
+    
+    // New timers append at the tail; cascaded ones settle behind any
+    // earlier-scheduled timer already in the slot
+    uint32_t after = wheel->tails[level][slot];
+    while (after != GOON_TIMER_NIL && wheel->timers[after].sequence > timer->sequence) {
+        after = wheel->timers[after].prev;
+    }
+    
+    timer->prev = after;
+    if (after != GOON_TIMER_NIL) {
+        timer->next = wheel->timers[after].next;
+        wheel->timers[after].next = index;
+    } else {
+        timer->next = wheel->slots[level][slot];
+        wheel->slots[level][slot] = index;
+    }
+    
+    if (timer->next != GOON_TIMER_NIL) {
+        wheel->timers[timer->next].prev = index;
+    } else {
+        wheel->tails[level][slot] = index;
+    }
+    wheel->level_count[level]++;
+}
+
+static void goon_timer_unlink(goon_timer_wheel_t *wheel, uint32_t index) {
+    goon_timer_t *timer = &wheel->timers[index];
+    
+    if (timer->prev != GOON_TIMER_NIL) {
+        wheel->timers[timer->prev].next = timer->next;
+    } else {
+        wheel->slots[timer->level][timer->slot] = timer->next;
+    }
+    
+    if (timer->next != GOON_TIMER_NIL) {
+        wheel->timers[timer->next].prev = timer->prev;
+    } else {
+        wheel->tails[timer->level][timer->slot] = timer->prev;
+    }
+    
+    wheel->level_count[timer->level]--;
+}
+
+goon_timer_id_t goon_timer_wheel_schedule(goon_timer_wheel_t *wheel, goon_event_t *event,
+                                          uint64_t when_ms, uint64_t interval_ms) {
+    if (!wheel || !event) return 0;
+    
+    pthread_mutex_lock(&wheel->lock);
+    
+    uint32_t index = goon_timer_alloc(wheel);
+    if (index == GOON_TIMER_NIL) {
+        pthread_mutex_unlock(&wheel->lock);
+        GOON_ERROR_LOG("Failed to allocate timer");
+        return 0;
+    }
+    
+    goon_timer_t *timer = &wheel->timers[index];
+    uint64_t tick = when_ms > wheel->origin_ms ? when_ms - wheel->origin_ms : 0;
+    
+    // Already due: fire on the next advance
+    timer->expires = tick > wheel->current ? tick : wheel->current + 1;
+    timer->interval = interval_ms;
+    timer->sequence = wheel->next_sequence++;
+    timer->event = event;
+    timer->active = true;
+    goon_timer_link(wheel, index);
+    wheel->active++;
+    
+    goon_timer_id_t id = ((uint64_t)timer->generation << 32) | (uint64_t)(index + 1);
+    pthread_mutex_unlock(&wheel->lock);
+    
+    return id;
+}
+
+int goon_timer_wheel_cancel(goon_timer_wheel_t *wheel, goon_timer_id_t id) {
+    if (!wheel) return GOON_ERROR_NULL_PTR;
+    
+    uint32_t index = (uint32_t)(id & 0xffffffffu) - 1;
+    uint32_t generation = (uint32_t)(id >> 32);
+    
+    pthread_mutex_lock(&wheel->lock);
+    
+    if (id == 0 || index >= wheel->capacity || !wheel->timers[index].active ||
+        wheel->timers[index].generation != generation) {
+        pthread_mutex_unlock(&wheel->lock);
+        return GOON_ERROR_NOT_FOUND;
+    }
+    
+    goon_event_t *event = wheel->timers[index].event;
+    goon_timer_unlink(wheel, index);
+    goon_timer_free(wheel, index);
+    wheel->active--;
+    
+    pthread_mutex_unlock(&wheel->lock);
+    
+    goon_event_destroy(event);
+    return GOON_SUCCESS;
+}
+
+static void goon_timer_cascade(goon_timer_wheel_t *wheel, int level) {
+    uint32_t slot = (uint32_t)((wheel->current >> (GOON_WHEEL_BITS * level)) & GOON_WHEEL_MASK);
+    uint32_t index = wheel->slots[level][slot];
+    
+    wheel->slots[level][slot] = GOON_TIMER_NIL;
+    wheel->tails[level][slot] = GOON_TIMER_NIL;
+    
+    while (index != GOON_TIMER_NIL) {
+        uint32_t next = wheel->timers[index].next;
+        wheel->level_count[level]--;
+        goon_timer_link(wheel, index);
+        index = next;
+    }
+}
+
+/*
+ * Advance the wheel to now_ms and return due events as a chain linked
+ * through ->next. Periodic timers hand out a clone and are re-armed.
+ */
+size_t goon_timer_wheel_advance(goon_timer_wheel_t *wheel, uint64_t now_ms, goon_event_t **due) {
+    if (!wheel || !due) return 0;
+    
+    *due = NULL;
+    goon_event_t *tail = NULL;
+    size_t count = 0;
+    
+    pthread_mutex_lock(&wheel->lock);
+    
+    uint64_t target = now_ms > wheel->origin_ms ? now_ms - wheel->origin_ms : 0;
+    
+    while (wheel->current < target) {
+        if (wheel->active == 0) {
+            wheel->current = target;
+            break;
+        }
+        
+        // Nothing in level 0: skip straight to the next cascade boundary
+        if (wheel->level_count[0] == 0) {
+            uint64_t boundary = (wheel->current | GOON_WHEEL_MASK) + 1;
+            if (boundary > target) {
+                wheel->current = target;
+                break;
+            }
+            wheel->current = boundary - 1;
+        }
+        
+        wheel->current++;
+        
+        for (int level = 1; level < GOON_WHEEL_LEVELS; level++) {
+            if (wheel->current & (((uint64_t)1 << (GOON_WHEEL_BITS * level)) - 1)) break;
+            goon_timer_cascade(wheel, level);
+        }
+        
+        uint32_t slot = (uint32_t)(wheel->current & GOON_WHEEL_MASK);
+        uint32_t index = wheel->slots[0][slot];
+        wheel->slots[0][slot] = GOON_TIMER_NIL;
+        wheel->tails[0][slot] = GOON_TIMER_NIL;
+        
+        while (index != GOON_TIMER_NIL) {
+            goon_timer_t *timer = &wheel->timers[index];
+            uint32_t next = timer->next;
+            goon_event_t *event;
+            
+            wheel->level_count[0]--;
+            
+            if (timer->interval > 0) {
+                event = goon_event_clone(timer->event);
+                
+                // Re-arm on the original cadence; periods missed while the
+                // wheel was not advanced collapse into this one firing
+                timer->expires += timer->interval;
+                if (timer->expires <= target) {
+                    uint64_t behind = target - timer->expires;
+                    timer->expires += (behind / timer->interval + 1) * timer->interval;
+                }
+                timer->sequence = wheel->next_sequence++;
+                goon_timer_link(wheel, index);
+            } else {
+                event = timer->event;
+                goon_timer_free(wheel, index);
+                wheel->active--;
+            }
+            
+            if (event) {
+                event->next = NULL;
+                if (tail) {
+                    tail->next = event;
+                } else {
+                    *due = event;
+                }
+                tail = event;
+                count++;
+            }
+            
+            index = next;
+        }
+    }
+    
+    pthread_mutex_unlock(&wheel->lock);
+    
+    return count;
+}
+
+// Absolute ms at which the wheel next needs advancing; UINT64_MAX when empty
+uint64_t goon_timer_wheel_next_expiry(goon_timer_wheel_t *wheel) {
+    if (!wheel) return UINT64_MAX;
+    
+    pthread_mutex_lock(&wheel->lock);
+    
+    uint64_t next = UINT64_MAX;
+    if (wheel->active > 0) {
+        // Higher levels cannot fire before the next cascade boundary
+        next = (wheel->current | GOON_WHEEL_MASK) + 1;
+        if (wheel->level_count[0] > 0) {
+            for (uint64_t tick = wheel->current + 1; tick <= wheel->current + GOON_WHEEL_SLOTS; tick++) {
+                if (wheel->slots[0][tick & GOON_WHEEL_MASK] != GOON_TIMER_NIL) {
+                    if (tick < next) next = tick;
+                    break;
+                }
+            }
+        }
+        next += wheel->origin_ms;
+    }
+    
+    pthread_mutex_unlock(&wheel->lock);
+    return next;
+}
+
+size_t goon_timer_wheel_pending(goon_timer_wheel_t *wheel) {
+    if (!wheel) return 0;
+    
+    pthread_mutex_lock(&wheel->lock);
+    size_t active = wheel->active;
+    pthread_mutex_unlock(&wheel->lock);
+    
+    return active;
+}
+
+/* ============================================================================
+ * COALESCING INDEX FUNCTIONS
+ * ============================================================================ */
+
+/*
+ * Open-addressing map from coalescing key to the queued event carrying it.
+ * Each indexed event remembers its slot (coalesce_slot, 1-based) so the
+ * consumer can drop the entry in O(1) when it pops the event. Deleted
+ * entries become tombstones so stored slots never move until a rehash.
+ */
+
+goon_coalesce_index_t* goon_coalesce_index_create(size_t capacity) {
+    goon_coalesce_index_t *index = (goon_coalesce_index_t*)malloc(sizeof(goon_coalesce_index_t));
+    if (!index) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_coalesce_index_t");
+        return NULL;
+    }
+    
+    index->capacity = goon_next_pow2(capacity > 0 ? capacity : GOON_COALESCE_INITIAL_SIZE);
+    index->entries = (goon_coalesce_entry_t*)calloc(index->capacity, sizeof(goon_coalesce_entry_t));
+    if (!index->entries) {
+        GOON_ERROR_LOG("Failed to allocate memory for coalescing entries");
+        free(index);
+        return NULL;
+    }
+    
+    index->live = 0;
+    index->tombstones = 0;
+    return index;
+}
+
+void goon_coalesce_index_destroy(goon_coalesce_index_t *index) {
+    if (!index) return;
+    free(index->entries);
+    free(index);
+}
+
+static goon_coalesce_entry_t* goon_coalesce_index_find(goon_coalesce_index_t *index,
+                                                       const char *key, uint64_t hash) {
+    size_t mask = index->capacity - 1;
+    
+    for (size_t i = hash & mask, probes = 0; probes < index->capacity; i = (i + 1) & mask, probes++) {
+        goon_coalesce_entry_t *entry = &index->entries[i];
+        if (entry->state == GOON_COALESCE_EMPTY) return NULL;
+        if (entry->state == GOON_COALESCE_LIVE && entry->hash == hash &&
+            strcmp(entry->key, key) == 0) {
+            return entry;
+        }
+    }
+    
+    return NULL;
+}
+
+static void goon_coalesce_index_place(goon_coalesce_index_t *index, uint64_t hash,
+                                      const char *key, goon_event_t *event) {
+    size_t mask = index->capacity - 1;
+    size_t i = hash & mask;
+    
+    while (index->entries[i].state == GOON_COALESCE_LIVE) {
+        i = (i + 1) & mask;
+    }
+    
+    goon_coalesce_entry_t *entry = &index->entries[i];
+    if (entry->state == GOON_COALESCE_TOMBSTONE) {
+        index->tombstones--;
+    }
+    
+    entry->state = GOON_COALESCE_LIVE;
+    entry->hash = hash;
+    entry->event = event;
+    strncpy(entry->key, key, GOON_MAX_NAME_LEN - 1);
+    entry->key[GOON_MAX_NAME_LEN - 1] = '\0';
+    
+    atomic_store_explicit(&event->coalesce_slot, (uint32_t)(i + 1), memory_order_relaxed);
+    index->live++;
+}
+
+static int goon_coalesce_index_rehash(goon_coalesce_index_t *index, size_t capacity) {
+    goon_coalesce_entry_t *old = index->entries;
+    size_t old_capacity = index->capacity;
+    
+    goon_coalesce_entry_t *entries = (goon_coalesce_entry_t*)calloc(capacity, sizeof(goon_coalesce_entry_t));
+    if (!entries) return GOON_ERROR_OUT_OF_MEMORY;
+    
+    index->entries = entries;
+    index->capacity = capacity;
+    index->live = 0;
+    index->tombstones = 0;
+    
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old[i].state == GOON_COALESCE_LIVE) {
+            goon_coalesce_index_place(index, old[i].hash, old[i].key, old[i].event);
+        }
+    }
+    
+    free(old);
+    return GOON_SUCCESS;
+}
+
+int goon_coalesce_index_insert(goon_coalesce_index_t *index, const char *key, goon_event_t *event) {
+    if (!index || !key || !event) return GOON_ERROR_NULL_PTR;
+    
+    // Stored keys are not truncated: a cut key would never match its own lookups
+    if (strlen(key) >= GOON_MAX_NAME_LEN) return GOON_ERROR_INVALID_PARAM;
+    
+    // Keep live entries plus tombstones under half the table
+    if ((index->live + index->tombstones + 1) * 2 > index->capacity) {
+        size_t capacity = index->capacity;
+        if ((index->live + 1) * 2 > capacity / 2) {
+            capacity *= 2;
+        }
+        int result = goon_coalesce_index_rehash(index, capacity);
+        if (result != GOON_SUCCESS) return result;
+    }
+    
+    goon_coalesce_index_place(index, goon_hash_string(key), key, event);
+    return GOON_SUCCESS;
+}
+
+void goon_coalesce_index_remove(goon_coalesce_index_t *index, goon_event_t *event) {
+    if (!index || !event) return;
+    
+    uint32_t slot = atomic_load_explicit(&event->coalesce_slot, memory_order_relaxed);
+    if (slot == 0) return;
+    
+    goon_coalesce_entry_t *entry = &index->entries[slot - 1];
+    if (entry->state == GOON_COALESCE_LIVE && entry->event == event) {
+        entry->state = GOON_COALESCE_TOMBSTONE;
+        entry->event = NULL;
+        index->live--;
+        index->tombstones++;
+    }
+    
+    atomic_store_explicit(&event->coalesce_slot, 0, memory_order_relaxed);
+}
+
+/* ============================================================================
+ * DISK QUEUE FUNCTIONS
+ * ============================================================================ */
+
+/*
+ * Append-only event log in preallocated, memory-mapped segment files
+ * (goon-<seq>.seg). Appends and reads are plain memory copies; syscalls
+ * only happen when a segment is opened, recycled or synced. A record is
+ * valid when its tag matches the segment sequence and its checksum holds,
+ * so recycled files never need zeroing and a torn write ends the log.
+ *
+ * The committed read offset lives in each segment header, so a restarted
+ * process resumes after the last committed record (at-least-once). Not
+ * thread-safe; the context serialises access with space_lock.
+ */
+
+static uint64_t g_goon_instance = 0;
+
+static size_t goon_disk_align(size_t n) {
+    return (n + 7) & ~(size_t)7;
+}
+
+static uint32_t goon_disk_checksum(const goon_disk_record_t *record) {
+    // FNV-1a over everything after the length and checksum fields
+    const uint8_t *bytes = (const uint8_t*)record + 2 * sizeof(uint32_t);
+    size_t len = record->length - 2 * sizeof(uint32_t);
+    uint32_t hash = 2166136261u;
+    
+    for (size_t i = 0; i < len; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    
+    return hash;
+}
+
+static void goon_disk_path(goon_disk_queue_t *dq, char *path, size_t size, uint64_t sequence, bool free_slot) {
+    snprintf(path, size, free_slot ? "%s/goon-free-%016llx.seg" : "%s/goon-%016llx.seg",
+             dq->dir, (unsigned long long)sequence);
+}
+
+static goon_disk_segment_t* goon_disk_segment_map(const char *path, size_t size, bool create) {
+    int fd = open(path, O_RDWR | (create ? O_CREAT : 0), 0644);
+    if (fd < 0) {
+        GOON_ERROR_LOG("Failed to open segment '%s': %s", path, strerror(errno));
+        return NULL;
+    }
+    
+    if (create) {
+        // Preallocate so appends never extend the file
+        if (posix_fallocate(fd, 0, (off_t)size) != 0 && ftruncate(fd, (off_t)size) != 0) {
+            GOON_ERROR_LOG("Failed to preallocate segment '%s'", path);
+            close(fd);
+            return NULL;
+        }
+    } else {
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(goon_disk_header_t)) {
+            close(fd);
+            return NULL;
+        }
+        size = (size_t)st.st_size;
+    }
+    
+    void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        GOON_ERROR_LOG("Failed to map segment '%s': %s", path, strerror(errno));
+        return NULL;
+    }
+    
+    goon_disk_segment_t *segment = (goon_disk_segment_t*)malloc(sizeof(goon_disk_segment_t));
+    if (!segment) {
+        munmap(map, size);
+        return NULL;
+    }
+    
+    segment->sequence = 0;
+    segment->map = (uint8_t*)map;
+    segment->size = size;
+    segment->end = sizeof(goon_disk_header_t);
+    segment->next = NULL;
+    return segment;
+}
+
+static void goon_disk_segment_unmap(goon_disk_segment_t *segment) {
+    munmap(segment->map, segment->size);
+    free(segment);
+}
+
+static goon_disk_header_t* goon_disk_header(goon_disk_segment_t *segment) {
+    return (goon_disk_header_t*)segment->map;
+}
+
+static size_t goon_disk_scan(goon_disk_segment_t *segment, size_t offset, size_t *count) {
+    while (offset + sizeof(goon_disk_record_t) <= segment->size) {
+        goon_disk_record_t *record = (goon_disk_record_t*)(segment->map + offset);
+        
+        if (record->length < sizeof(goon_disk_record_t) || (record->length & 7) ||
+            offset + record->length > segment->size ||
+            record->tag != (uint32_t)segment->sequence ||
+            record->checksum != goon_disk_checksum(record)) {
+            break;
+        }
+        
+        offset += record->length;
+        (*count)++;
+    }
+    
+    return offset;
+}
+
+static int goon_disk_roll(goon_disk_queue_t *dq) {
+    char path[GOON_BUFFER_SIZE + 64];
+    uint64_t sequence = dq->next_sequence;
+    goon_disk_segment_t *segment = dq->free_list;
+    
+    goon_disk_path(dq, path, sizeof(path), sequence, false);
+    
+    if (segment) {
+        char old_path[GOON_BUFFER_SIZE + 64];
+        goon_disk_path(dq, old_path, sizeof(old_path), segment->sequence, true);
+        if (rename(old_path, path) != 0) {
+            GOON_ERROR_LOG("Failed to recycle segment '%s': %s", old_path, strerror(errno));
+            return GOON_ERROR;
+        }
+        dq->free_list = segment->next;
+        dq->free_count--;
+    } else {
+        segment = goon_disk_segment_map(path, dq->segment_size, true);
+        if (!segment) return GOON_ERROR_OUT_OF_MEMORY;
+    }
+    
+    goon_disk_header_t *header = goon_disk_header(segment);
+    header->sequence = sequence;
+    header->read_offset = sizeof(goon_disk_header_t);
+    header->magic = GOON_DISK_MAGIC;
+    
+    segment->sequence = sequence;
+    segment->end = sizeof(goon_disk_header_t);
+    segment->next = NULL;
+    
+    if (dq->tail) {
+        dq->tail->next = segment;
+    } else {
+        dq->head = segment;
+        dq->read_seg = segment;
+        dq->read_offset = segment->end;
+    }
+    dq->tail = segment;
+    dq->next_sequence++;
+    
+    return GOON_SUCCESS;
+}
+
+static void goon_disk_recycle(goon_disk_queue_t *dq, goon_disk_segment_t *segment) {
+    char path[GOON_BUFFER_SIZE + 64];
+    goon_disk_path(dq, path, sizeof(path), segment->sequence, false);
+    
+    if (dq->free_count < GOON_DISK_FREE_SEGMENTS) {
+        char free_path[GOON_BUFFER_SIZE + 64];
+        goon_disk_path(dq, free_path, sizeof(free_path), segment->sequence, true);
+        
+        goon_disk_header(segment)->magic = GOON_DISK_MAGIC_FREE;
+        if (rename(path, free_path) == 0) {
+            segment->next = dq->free_list;
+            dq->free_list = segment;
+            dq->free_count++;
+            dq->recycled++;
+            return;
+        }
+    }
+    
+    unlink(path);
+    goon_disk_segment_unmap(segment);
+}
+
+static int goon_disk_compare_seq(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+static int goon_disk_recover(goon_disk_queue_t *dq) {
+    DIR *dir = opendir(dq->dir);
+    if (!dir) return GOON_ERROR;
+    
+    uint64_t *sequences = NULL;
+    size_t count = 0, capacity = 0;
+    struct dirent *entry;
+    
+    while ((entry = readdir(dir)) != NULL) {
+        unsigned long long sequence;
+        char path[GOON_BUFFER_SIZE + 64];
+        
+        if (sscanf(entry->d_name, "goon-free-%16llx.seg", &sequence) == 1) {
+            goon_disk_path(dq, path, sizeof(path), sequence, true);
+            goon_disk_segment_t *segment = goon_disk_segment_map(path, 0, false);
+            if (!segment) continue;
+            
+            segment->sequence = sequence;
+            segment->next = dq->free_list;
+            dq->free_list = segment;
+            dq->free_count++;
+            if (sequence >= dq->next_sequence) dq->next_sequence = sequence + 1;
+        } else if (sscanf(entry->d_name, "goon-%16llx.seg", &sequence) == 1) {
+            if (count == capacity) {
+                capacity = capacity ? capacity * 2 : 16;
+                uint64_t *grown = (uint64_t*)realloc(sequences, capacity * sizeof(uint64_t));
+                if (!grown) break;
+                sequences = grown;
+            }
+            sequences[count++] = sequence;
+        }
+    }
+    closedir(dir);
+    
+    // An empty directory leaves sequences NULL
+    if (count > 0) {
+        qsort(sequences, count, sizeof(uint64_t), goon_disk_compare_seq);
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        char path[GOON_BUFFER_SIZE + 64];
+        goon_disk_path(dq, path, sizeof(path), sequences[i], false);
+        
+        goon_disk_segment_t *segment = goon_disk_segment_map(path, 0, false);
+        if (!segment) continue;
+        
+        goon_disk_header_t *header = goon_disk_header(segment);
+        if (header->magic != GOON_DISK_MAGIC || header->sequence != sequences[i] ||
+            header->read_offset < sizeof(goon_disk_header_t) || header->read_offset > segment->size) {
+            GOON_WARN("Ignoring invalid segment '%s'", path);
+            goon_disk_segment_unmap(segment);
+            continue;
+        }
+        
+        size_t records = 0;
+        segment->sequence = sequences[i];
+        segment->end = goon_disk_scan(segment, header->read_offset, &records);
+        
+        if (dq->tail) {
+            dq->tail->next = segment;
+        } else {
+            dq->head = segment;
+            dq->read_seg = segment;
+            dq->read_offset = header->read_offset;
+        }
+        dq->tail = segment;
+        dq->pending += records;
+        
+        if (sequences[i] >= dq->next_sequence) dq->next_sequence = sequences[i] + 1;
+    }
+    
+    free(sequences);
+    return GOON_SUCCESS;
+}
+
+goon_disk_queue_t* goon_disk_queue_open(const char *dir, size_t segment_size) {
+    if (!dir) return NULL;
+    
+    goon_disk_queue_t *dq = (goon_disk_queue_t*)calloc(1, sizeof(goon_disk_queue_t));
+    if (!dq) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_disk_queue_t");
+        return NULL;
+    }
+    
+    strncpy(dq->dir, dir, sizeof(dq->dir) - 1);
+    dq->segment_size = segment_size > 0 ? segment_size : GOON_DISK_SEGMENT_SIZE;
+    dq->next_sequence = 1;
+    
+    if (g_goon_instance == 0) {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        g_goon_instance = ((uint64_t)getpid() << 32) ^ (uint64_t)ts.tv_sec ^ (uint64_t)ts.tv_nsec;
+    }
+    
+    mkdir(dir, 0755);
+    if (goon_disk_recover(dq) != GOON_SUCCESS) {
+        GOON_ERROR_LOG("Failed to open disk queue directory '%s'", dir);
+        free(dq);
+        return NULL;
+    }
+    
+    if (dq->pending > 0) {
+        GOON_INFO("Recovered %zu undispatched events from '%s'", dq->pending, dir);
+    }
+    
+    return dq;
+}
+
+void goon_disk_queue_close(goon_disk_queue_t *dq) {
+    if (!dq) return;
+    
+    goon_disk_segment_t *lists[2] = {dq->head, dq->free_list};
+    for (int i = 0; i < 2; i++) {
+        goon_disk_segment_t *segment = lists[i];
+        while (segment) {
+            goon_disk_segment_t *next = segment->next;
+            goon_disk_segment_unmap(segment);
+            segment = next;
+        }
+    }
+    
+    free(dq);
+}
+
+int goon_disk_queue_append(goon_disk_queue_t *dq, goon_event_t *event) {
+    if (!dq || !event) return GOON_ERROR_NULL_PTR;
+    
+    goon_data_t *data = event->data;
+    const char *name = goon_event_get_name(event);
+    size_t name_len = strlen(name);
+    size_t data_len = data && data->value && data->size > 0 ? data->size : 0;
+    size_t total = goon_disk_align(sizeof(goon_disk_record_t) + name_len + data_len);
+    
+    if (total > dq->segment_size - sizeof(goon_disk_header_t)) {
+        return GOON_ERROR_OVERFLOW;
+    }
+    
+    if (!dq->tail || dq->tail->end + total > dq->tail->size) {
+        int result = goon_disk_roll(dq);
+        if (result != GOON_SUCCESS) return result;
+    }
+    
+    goon_disk_segment_t *segment = dq->tail;
+    goon_disk_record_t *record = (goon_disk_record_t*)(segment->map + segment->end);
+    
+    record->length = 0;
+    record->tag = (uint32_t)segment->sequence;
+    record->id = event->id;
+    record->priority = event->priority;
+    record->data_type = data ? (int32_t)data->type : -1;
+    record->timestamp = (int64_t)goon_event_get_timestamp(event);
+    record->instance = g_goon_instance;
+    record->user_data = (uint64_t)(uintptr_t)event->user_data;
+    record->data_ptr = data && data_len == 0 ? (uint64_t)(uintptr_t)data->value : 0;
+    record->data_size = data_len;
+    record->name_len = (uint32_t)name_len;
+    record->reserved = 0;
+    
+    uint8_t *body = (uint8_t*)(record + 1);
+    memcpy(body, name, name_len);
+    if (data_len > 0) {
+        memcpy(body + name_len, data->value, data_len);
+    }
+    memset(body + name_len + data_len, 0, total - sizeof(goon_disk_record_t) - name_len - data_len);
+    
+    // Nothing orders these stores against writeback. Recovery only trusts
+    // a record whose tag and checksum match, so a torn one ends the log.
+    record->length = (uint32_t)total;
+    record->checksum = goon_disk_checksum(record);
+    
+    segment->end += total;
+    dq->pending++;
+    dq->appended++;
+    
+    return GOON_SUCCESS;
+}
+
+static goon_disk_record_t* goon_disk_cursor(goon_disk_queue_t *dq) {
+    while (dq->read_seg) {
+        if (dq->read_offset < dq->read_seg->end) {
+            return (goon_disk_record_t*)(dq->read_seg->map + dq->read_offset);
+        }
+        
+        if (dq->read_seg == dq->tail) return NULL;
+        
+        dq->read_seg = dq->read_seg->next;
+        dq->read_offset = goon_disk_header(dq->read_seg)->read_offset;
+    }
+    
+    return NULL;
+}
+
+goon_event_t* goon_disk_queue_peek(goon_disk_queue_t *dq) {
+    if (!dq) return NULL;
+    
+    goon_disk_record_t *record = goon_disk_cursor(dq);
+    if (!record) return NULL;
+    
+    char name[GOON_MAX_NAME_LEN];
+    size_t name_len = record->name_len < GOON_MAX_NAME_LEN - 1 ? record->name_len : GOON_MAX_NAME_LEN - 1;
+    memcpy(name, record + 1, name_len);
+    name[name_len] = '\0';
+    
+    goon_event_t *event = goon_event_create(name, (goon_priority_t)record->priority);
+    if (!event) return NULL;
+    
+    // Pointers are only meaningful inside the process that wrote them
+    bool same_instance = record->instance == g_goon_instance;
+    
+    event->id = record->id;
+    // Journals keep whole seconds
+    event->timestamp_ns = (uint64_t)record->timestamp * 1000000000ull;
+    event->user_data = same_instance ? (void*)(uintptr_t)record->user_data : NULL;
+    
+    if (record->data_type >= 0) {
+        void *value = record->data_size > 0
+                          ? (void*)((uint8_t*)(record + 1) + record->name_len)
+                          : (same_instance ? (void*)(uintptr_t)record->data_ptr : NULL);
+        event->data = goon_data_create((goon_data_type_t)record->data_type, value, record->data_size);
+    }
+    
+    return event;
+}
+
+void goon_disk_queue_advance(goon_disk_queue_t *dq) {
+    if (!dq) return;
+    
+    goon_disk_record_t *record = goon_disk_cursor(dq);
+    if (!record) return;
+    
+    dq->read_offset += record->length;
+    dq->pending--;
+}
+
+int goon_disk_queue_commit(goon_disk_queue_t *dq) {
+    if (!dq) return GOON_ERROR_NULL_PTR;
+    
+    // Segments before the read cursor are fully consumed: mark and recycle
+    while (dq->head && dq->head != dq->read_seg) {
+        goon_disk_segment_t *segment = dq->head;
+        goon_disk_header(segment)->read_offset = segment->end;
+        dq->head = segment->next;
+        goon_disk_recycle(dq, segment);
+    }
+    
+    if (dq->read_seg) {
+        goon_disk_header(dq->read_seg)->read_offset = dq->read_offset;
+    }
+    
+    return GOON_SUCCESS;
+}
+
+int goon_disk_queue_sync(goon_disk_queue_t *dq) {
+    if (!dq) return GOON_ERROR_NULL_PTR;
+    
+    for (goon_disk_segment_t *segment = dq->head; segment; segment = segment->next) {
+        if (msync(segment->map, segment->size, MS_SYNC) != 0) {
+            GOON_ERROR_LOG("Failed to sync disk queue: %s", strerror(errno));
+            return GOON_ERROR;
+        }
+    }
+    
+    return GOON_SUCCESS;
+}
+
+size_t goon_disk_queue_pending(goon_disk_queue_t *dq) {
+    if (!dq) return 0;
+    return dq->pending;
+}
+
+/* ============================================================================
+ * STACK MANAGEMENT FUNCTIONS
+ * ============================================================================ */
+
+goon_stack_t* goon_stack_create(size_t capacity) {
+    goon_stack_t *stack = (goon_stack_t*)malloc(sizeof(goon_stack_t));
+    if (!stack) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_stack_t");
+        return NULL;
+    }
+    
+    stack->capacity = capacity > 0 ? capacity : GOON_MAX_STACK_SIZE;
+    stack->items = (void**)calloc(stack->capacity, sizeof(void*));
+    if (!stack->items) {
+        GOON_ERROR_LOG("Failed to allocate memory for stack items");
+        free(stack);
+        return NULL;
+    }
+    
+    stack->size = 0;
+    
+    return stack;
+}
+
+void goon_stack_destroy(goon_stack_t *stack) {
+    if (!stack) return;
+    
+    if (stack->items) {
+        free(stack->items);
+    }
+    
+    free(stack);
+}
+
+int goon_stack_push(goon_stack_t *stack, void *item) {
+    if (!stack) return GOON_ERROR_NULL_PTR;
+    
+    if (stack->size >= stack->capacity) {
+        GOON_WARN("Stack is full, cannot push item");
+        return GOON_ERROR_OVERFLOW;
+    }
+    
+    stack->items[stack->size++] = item;
+    return GOON_SUCCESS;
+}
+
+void* goon_stack_pop(goon_stack_t *stack) {
+    if (!stack || stack->size == 0) return NULL;
+    
+    return stack->items[--stack->size];
+}
+
+void* goon_stack_peek(goon_stack_t *stack) {
+    if (!stack || stack->size == 0) return NULL;
+    
+    return stack->items[stack->size - 1];
+}
+
+size_t goon_stack_size(goon_stack_t *stack) {
+    if (!stack) return 0;
+    return stack->size;
+}
+
+bool goon_stack_is_empty(goon_stack_t *stack) {
+    if (!stack) return true;
+    return stack->size == 0;
+}
+
+/* ============================================================================
+ * CACHE MANAGEMENT FUNCTIONS
+ * ============================================================================ */
+
+goon_cache_t* goon_cache_create(void) {
+    goon_cache_t *cache = (goon_cache_t*)malloc(sizeof(goon_cache_t));
+    if (!cache) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_cache_t");
+        return NULL;
+    }
+    
+    memset(cache->keys, 0, sizeof(cache->keys));
+    memset(cache->values, 0, sizeof(cache->values));
+    memset(cache->timestamps, 0, sizeof(cache->timestamps));
+    memset(cache->sizes, 0, sizeof(cache->sizes));
+    cache->count = 0;
+    
+    return cache;
+}
+
+void goon_cache_destroy(goon_cache_t *cache) {
+    if (!cache) return;
+    
+    for (size_t i = 0; i < cache->count; i++) {
+        if (cache->values[i]) {
+            free(cache->values[i]);
+        }
+    }
+    
+    free(cache);
+}
+
+int goon_cache_set(goon_cache_t *cache, const char *key, void *value, size_t size) {
+    if (!cache || !key || !value) return GOON_ERROR_NULL_PTR;
+    
+    // Check if key exists
+    for (size_t i = 0; i < cache->count; i++) {
+        if (strcmp(cache->keys[i], key) == 0) {
+            if (cache->values[i]) {
+                free(cache->values[i]);
+            }
+            
+            cache->values[i] = malloc(size);
+            if (!cache->values[i]) {
+                return GOON_ERROR_OUT_OF_MEMORY;
+            }
+            
+            memcpy(cache->values[i], value, size);
+            cache->sizes[i] = size;
+            cache->timestamps[i] = time(NULL);
+            return GOON_SUCCESS;
+        }
+    }
+    
+    // Add new entry
+    if (cache->count >= GOON_CACHE_SIZE) {
+        // Evict oldest entry
+        size_t oldest_idx = 0;
+        time_t oldest_time = cache->timestamps[0];
+        
+        for (size_t i = 1; i < GOON_CACHE_SIZE; i++) {
+            if (cache->timestamps[i] < oldest_time) {
+                oldest_time = cache->timestamps[i];
+                oldest_idx = i;
+            }
+        }
+        
+        if (cache->values[oldest_idx]) {
+            free(cache->values[oldest_idx]);
+        }
+        
+        strncpy(cache->keys[oldest_idx], key, GOON_MAX_NAME_LEN - 1);
+        cache->keys[oldest_idx][GOON_MAX_NAME_LEN - 1] = '\0';
+        
+        cache->values[oldest_idx] = malloc(size);
+        if (!cache->values[oldest_idx]) {
+            return GOON_ERROR_OUT_OF_MEMORY;
+        }
+        
+        memcpy(cache->values[oldest_idx], value, size);
+        cache->sizes[oldest_idx] = size;
+        cache->timestamps[oldest_idx] = time(NULL);
+    } else {
+        strncpy(cache->keys[cache->count], key, GOON_MAX_NAME_LEN - 1);
+        cache->keys[cache->count][GOON_MAX_NAME_LEN - 1] = '\0';
+        
+        cache->values[cache->count] = malloc(size);
+        if (!cache->values[cache->count]) {
+            return GOON_ERROR_OUT_OF_MEMORY;
+        }
+        
+        memcpy(cache->values[cache->count], value, size);
+        cache->sizes[cache->count] = size;
+        cache->timestamps[cache->count] = time(NULL);
+        cache->count++;
+    }
+    
+    return GOON_SUCCESS;
+}
+
+void* goon_cache_get(goon_cache_t *cache, const char *key, size_t *size) {
+    if (!cache || !key) return NULL;
+    
+    for (size_t i = 0; i < cache->count; i++) {
+        if (strcmp(cache->keys[i], key) == 0) {
+            cache->timestamps[i] = time(NULL);
+            if (size) {
+                *size = cache->sizes[i];
+            }
+            return cache->values[i];
+        }
+    }
+    
+    return NULL;
+}
+
+int goon_cache_remove(goon_cache_t *cache, const char *key) {
+    if (!cache || !key) return GOON_ERROR_NULL_PTR;
+    
+    for (size_t i = 0; i < cache->count; i++) {
+        if (strcmp(cache->keys[i], key) == 0) {
+            if (cache->values[i]) {
+                free(cache->values[i]);
+            }
+            
+            // Shift remaining entries
+            for (size_t j = i; j < cache->count - 1; j++) {
+                strcpy(cache->keys[j], cache->keys[j + 1]);
+                cache->values[j] = cache->values[j + 1];
+                cache->sizes[j] = cache->sizes[j + 1];
+                cache->timestamps[j] = cache->timestamps[j + 1];
+            }
+            
+            cache->count--;
+            return GOON_SUCCESS;
+        }
+    }
+    
+    return GOON_ERROR_NOT_FOUND;
+}
+
+void goon_cache_clear(goon_cache_t *cache) {
+    if (!cache) return;
+    
+    for (size_t i = 0; i < cache->count; i++) {
+        if (cache->values[i]) {
+            free(cache->values[i]);
+            cache->values[i] = NULL;
+        }
+    }
+    
+    cache->count = 0;
+}
+
+/* ============================================================================
+ * MEMORY POOL FUNCTIONS
+ * ============================================================================ */
+
+/*
+ * Objects come in power-of-two size classes from 16 bytes to 64 KiB.
+ * Every object is preceded by a small header recording its class and
+ * owning pool, so the object pointer doubles as the release handle.
+ *
+ * Threads do not touch the classes directly: each keeps a loaded and a
+ * previous magazine per class, and acquire/release are a pop or push on
+ * those. Only when both are empty (or full) does a thread lock the class
+ * and trade a whole magazine with its depot, so objects a consumer frees
+ * travel back to the producer's side in bulk. Each class keeps at most
+ * `capacity` free objects in its depot and free list; larger requests
+ * bypass the classes entirely.
+ */
+
+static pthread_once_t g_pool_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_pool_key;
+static __thread goon_pool_cache_t g_pool_cache[GOON_POOL_CACHE_WAYS];
+static __thread uint32_t g_pool_victim = 0;
+
+static inline uint32_t goon_pool_class_of(size_t size) {
+    if (size <= ((size_t)1 << GOON_POOL_MIN_SHIFT)) return 0;
+    return (uint32_t)(64 - __builtin_clzll((unsigned long long)(size - 1))) - GOON_POOL_MIN_SHIFT;
+}
+
+static inline size_t goon_pool_class_size(uint32_t size_class) {
+    return (size_t)1 << (size_class + GOON_POOL_MIN_SHIFT);
+}
+
+static inline goon_pool_block_t* goon_pool_block_of(void *obj) {
+    return (goon_pool_block_t*)obj - 1;
+}
+
+// Count how often a thread finds the class already locked
+static inline void goon_pool_class_lock(goon_pool_class_t *cls) {
+    if (pthread_mutex_trylock(&cls->lock) != 0) {
+        pthread_mutex_lock(&cls->lock);
+        cls->contended++;
+    }
+}
+
+goon_pool_t* goon_pool_create(size_t capacity, goon_alloc_func alloc, goon_free_func free_func) {
+    goon_pool_t *pool = (goon_pool_t*)calloc(1, sizeof(goon_pool_t));
+    if (!pool) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_pool_t");
+        return NULL;
+    }
+    
+    pool->capacity = capacity > 0 ? capacity : GOON_POOL_SIZE;
+    pool->alloc = alloc ? alloc : malloc;
+    pool->free = free_func ? free_func : free;
+    atomic_init(&pool->oversize, 0);
+    atomic_init(&pool->refs, 1);
+    
+    for (int i = 0; i < GOON_POOL_CLASSES; i++) {
+        pthread_mutex_init(&pool->classes[i].lock, NULL);
+    }
+    
+    return pool;
+}
+
+// Frees cached objects once the owner and every thread cache have let go
+static void goon_pool_put_ref(goon_pool_t *pool) {
+    if (atomic_fetch_sub(&pool->refs, 1) != 1) return;
+    
+    size_t leaked = atomic_load(&pool->oversize);
+    for (int i = 0; i < GOON_POOL_CLASSES; i++) {
+        goon_pool_class_t *cls = &pool->classes[i];
+        
+        goon_pool_block_t *block = cls->free_list;
+        while (block) {
+            goon_pool_block_t *next = block->next;
+            pool->free(block);
+            block = next;
+        }
+        
+        goon_pool_magazine_t *lists[2] = { cls->full, cls->empty };
+        for (int j = 0; j < 2; j++) {
+            while (lists[j]) {
+                goon_pool_magazine_t *next = lists[j]->next;
+                for (uint32_t k = 0; k < lists[j]->count; k++) {
+                    pool->free(lists[j]->blocks[k]);
+                }
+                free(lists[j]);
+                lists[j] = next;
+            }
+        }
+        
+        leaked += cls->allocated - cls->free_count - cls->depot_count;
+        pthread_mutex_destroy(&cls->lock);
+    }
+    
+    if (leaked > 0) {
+        GOON_WARN("Pool destroyed with %zu objects still acquired", leaked);
+    }
+    free(pool);
+}
+
+// Hand a thread's magazines back to the depots and drop its reference
+static void goon_pool_cache_flush(goon_pool_cache_t *cache) {
+    goon_pool_t *pool = cache->pool;
+    if (!pool) return;
+    
+    for (int i = 0; i < GOON_POOL_CLASSES; i++) {
+        goon_pool_magazine_t *magazines[2] = { cache->loaded[i], cache->previous[i] };
+        if (!magazines[0] && !magazines[1]) continue;
+        
+        goon_pool_class_t *cls = &pool->classes[i];
+        goon_pool_class_lock(cls);
+        for (int j = 0; j < 2; j++) {
+            goon_pool_magazine_t *magazine = magazines[j];
+            if (!magazine) continue;
+            
+            if (magazine->count > 0) {
+                magazine->next = cls->full;
+                cls->full = magazine;
+                cls->depot_count += magazine->count;
+            } else {
+                magazine->next = cls->empty;
+                cls->empty = magazine;
+            }
+        }
+        pthread_mutex_unlock(&cls->lock);
+    }
+    
+    memset(cache, 0, sizeof(*cache));
+    goon_pool_put_ref(pool);
+}
+
+static void goon_pool_thread_exit(void *arg) {
+    goon_pool_cache_t *caches = (goon_pool_cache_t*)arg;
+    for (int i = 0; i < GOON_POOL_CACHE_WAYS; i++) {
+        goon_pool_cache_flush(&caches[i]);
+    }
+}
+
+static void goon_pool_create_key(void) {
+    pthread_key_create(&g_pool_key, goon_pool_thread_exit);
+}
+
+static goon_pool_cache_t* goon_pool_cache_get(goon_pool_t *pool) {
+    goon_pool_cache_t *spare = NULL;
+    for (int i = 0; i < GOON_POOL_CACHE_WAYS; i++) {
+        if (g_pool_cache[i].pool == pool) return &g_pool_cache[i];
+        if (!spare && !g_pool_cache[i].pool) spare = &g_pool_cache[i];
+    }
+    
+    if (!spare) {
+        spare = &g_pool_cache[g_pool_victim++ % GOON_POOL_CACHE_WAYS];
+        goon_pool_cache_flush(spare);
+    }
+    
+    pthread_once(&g_pool_once, goon_pool_create_key);
+    pthread_setspecific(g_pool_key, g_pool_cache);
+    
+    atomic_fetch_add(&pool->refs, 1);
+    spare->pool = pool;
+    return spare;
+}
+
+void goon_pool_destroy(goon_pool_t *pool) {
+    if (!pool) return;
+    
+    for (int i = 0; i < GOON_POOL_CACHE_WAYS; i++) {
+        if (g_pool_cache[i].pool == pool) {
+            goon_pool_cache_flush(&g_pool_cache[i]);
+        }
+    }
+    goon_pool_put_ref(pool);
+}
+
+// Caller holds the class lock
+static goon_pool_magazine_t* goon_pool_magazine_get(goon_pool_class_t *cls) {
+    goon_pool_magazine_t *magazine = cls->empty;
+    if (magazine) {
+        cls->empty = magazine->next;
+    } else if ((magazine = (goon_pool_magazine_t*)malloc(sizeof(goon_pool_magazine_t))) != NULL) {
+        cls->magazines++;
+    }
+    
+    if (magazine) {
+        magazine->next = NULL;
+        magazine->count = 0;
+    }
+    return magazine;
+}
+
+static goon_pool_block_t* goon_pool_refill(goon_pool_class_t *cls, goon_pool_cache_t *cache, uint32_t size_class) {
+    goon_pool_block_t *block = NULL;
+    
+    goon_pool_class_lock(cls);
+    
+    // Trade the empty previous magazine for a full one from the depot
+    goon_pool_magazine_t *full = cls->full;
+    if (full) {
+        cls->full = full->next;
+        cls->depot_count -= full->count;
+        cls->depot_gets++;
+        if (cache->previous[size_class]) {
+            cache->previous[size_class]->next = cls->empty;
+            cls->empty = cache->previous[size_class];
+        }
+        cache->previous[size_class] = cache->loaded[size_class];
+        cache->loaded[size_class] = full;
+        block = full->blocks[--full->count];
+    } else if (cls->free_list) {
+        block = cls->free_list;
+        cls->free_list = block->next;
+        cls->free_count--;
+        
+        if (!cache->loaded[size_class]) {
+            cache->loaded[size_class] = goon_pool_magazine_get(cls);
+        }
+        goon_pool_magazine_t *magazine = cache->loaded[size_class];
+        while (magazine && magazine->count < GOON_POOL_MAGAZINE_SIZE && cls->free_list) {
+            magazine->blocks[magazine->count++] = cls->free_list;
+            cls->free_list = cls->free_list->next;
+            cls->free_count--;
+        }
+    } else {
+        // Nothing cached: the caller allocates, and counts it now
+        cls->allocated++;
+        cls->misses++;
+    }
+    
+    pthread_mutex_unlock(&cls->lock);
+    return block;
+}
+
+// The returned object holds at least `size` bytes
+void* goon_pool_acquire(goon_pool_t *pool, size_t size) {
+    if (!pool) return NULL;
+    
+    uint32_t size_class = goon_pool_class_of(size);
+    goon_pool_block_t *block = NULL;
+    
+    if (size_class >= GOON_POOL_CLASSES) {
+        block = (goon_pool_block_t*)pool->alloc(sizeof(goon_pool_block_t) + size);
+        if (!block) {
+            GOON_ERROR_LOG("Failed to allocate object from pool");
+            return NULL;
+        }
+        atomic_fetch_add_explicit(&pool->oversize, 1, memory_order_relaxed);
+    } else {
+        goon_pool_cache_t *cache = goon_pool_cache_get(pool);
+        goon_pool_magazine_t *loaded = cache->loaded[size_class];
+        goon_pool_magazine_t *previous = cache->previous[size_class];
+        
+        if (loaded && loaded->count > 0) {
+            block = loaded->blocks[--loaded->count];
+        } else if (previous && previous->count > 0) {
+            cache->loaded[size_class] = previous;
+            cache->previous[size_class] = loaded;
+            block = previous->blocks[--previous->count];
+        } else {
+            block = goon_pool_refill(&pool->classes[size_class], cache, size_class);
+        }
+        
+        if (!block) {
+            block = (goon_pool_block_t*)pool->alloc(sizeof(goon_pool_block_t) + goon_pool_class_size(size_class));
+            if (!block) {
+                goon_pool_class_t *cls = &pool->classes[size_class];
+                goon_pool_class_lock(cls);
+                cls->allocated--;
+                pthread_mutex_unlock(&cls->lock);
+                GOON_ERROR_LOG("Failed to allocate object from pool");
+                return NULL;
+            }
+        }
+    }
+    
+    block->pool = pool;
+    block->size_class = size_class;
+    block->magic = GOON_POOL_MAGIC;
+    return block + 1;
+}
+
+static void goon_pool_release_slow(goon_pool_t *pool, goon_pool_cache_t *cache, goon_pool_block_t *block) {
+    uint32_t size_class = block->size_class;
+    goon_pool_class_t *cls = &pool->classes[size_class];
+    goon_pool_magazine_t *trimmed = NULL;
+    
+    goon_pool_class_lock(cls);
+    
+    goon_pool_magazine_t *empty = goon_pool_magazine_get(cls);
+    if (!empty) {
+        // No magazine to spare: fall back to the class free list
+        if (cls->free_count + cls->depot_count < pool->capacity) {
+            block->next = cls->free_list;
+            cls->free_list = block;
+            cls->free_count++;
+            block = NULL;
+        } else {
+            cls->allocated--;
+        }
+        pthread_mutex_unlock(&cls->lock);
+        if (block) pool->free(block);
+        return;
+    }
+    
+    // Both magazines are full: the previous one goes to the depot, or back
+    // to the backing allocator when the depot already holds `capacity`
+    goon_pool_magazine_t *previous = cache->previous[size_class];
+    if (previous) {
+        if (cls->free_count + cls->depot_count + previous->count <= pool->capacity) {
+            previous->next = cls->full;
+            cls->full = previous;
+            cls->depot_count += previous->count;
+            cls->depot_puts++;
+        } else {
+            cls->allocated -= previous->count;
+            cls->magazines--;
+            trimmed = previous;
+        }
+    }
+    cache->previous[size_class] = cache->loaded[size_class];
+    cache->loaded[size_class] = empty;
+    pthread_mutex_unlock(&cls->lock);
+    
+    empty->blocks[empty->count++] = block;
+    
+    if (trimmed) {
+        for (uint32_t i = 0; i < trimmed->count; i++) {
+            pool->free(trimmed->blocks[i]);
+        }
+        free(trimmed);
+    }
+}
+
+int goon_pool_release(goon_pool_t *pool, void *obj) {
+    if (!pool || !obj) return GOON_ERROR_NULL_PTR;
+    
+    goon_pool_block_t *block = goon_pool_block_of(obj);
+    if (block->magic != GOON_POOL_MAGIC || block->pool != pool) {
+        return GOON_ERROR_INVALID_PARAM;
+    }
+    block->magic = GOON_POOL_MAGIC_FREE;
+    
+    if (block->size_class >= GOON_POOL_CLASSES) {
+        atomic_fetch_sub_explicit(&pool->oversize, 1, memory_order_relaxed);
+        pool->free(block);
+        return GOON_SUCCESS;
+    }
+    
+    uint32_t size_class = block->size_class;
+    goon_pool_cache_t *cache = goon_pool_cache_get(pool);
+    goon_pool_magazine_t *loaded = cache->loaded[size_class];
+    goon_pool_magazine_t *previous = cache->previous[size_class];
+    
+    if (loaded && loaded->count < GOON_POOL_MAGAZINE_SIZE) {
+        loaded->blocks[loaded->count++] = block;
+    } else if (previous && previous->count < GOON_POOL_MAGAZINE_SIZE) {
+        cache->loaded[size_class] = previous;
+        cache->previous[size_class] = loaded;
+        previous->blocks[previous->count++] = block;
+    } else {
+        goon_pool_release_slow(pool, cache, block);
+    }
+    
+    return GOON_SUCCESS;
+}
+
+/*
+ * Objects parked in other threads' magazines count as in use, so
+ * in_use overstates live objects by at most two magazines per thread and
+ * class. `contended` counts depot lock acquisitions that had to wait;
+ * a high ratio to depot_gets + depot_puts calls for larger magazines.
+ */
+int goon_pool_get_stats(goon_pool_t *pool, goon_pool_stats_t *stats) {
+    if (!pool || !stats) return GOON_ERROR_NULL_PTR;
+    
+    memset(stats, 0, sizeof(*stats));
+    for (int i = 0; i < GOON_POOL_CLASSES; i++) {
+        goon_pool_class_t *cls = &pool->classes[i];
+        
+        goon_pool_class_lock(cls);
+        stats->free[i] = cls->free_count + cls->depot_count;
+        stats->in_use[i] = cls->allocated - stats->free[i];
+        stats->misses += cls->misses;
+        stats->depot_gets += cls->depot_gets;
+        stats->depot_puts += cls->depot_puts;
+        stats->contended += cls->contended;
+        stats->magazines += cls->magazines;
+        pthread_mutex_unlock(&cls->lock);
+        
+        stats->total_in_use += stats->in_use[i];
+        stats->cached_bytes += stats->free[i] * goon_pool_class_size((uint32_t)i);
+    }
+    stats->oversize = atomic_load(&pool->oversize);
+    
+    return GOON_SUCCESS;
+}
+
+/* ============================================================================
+ * LATENCY HISTOGRAM FUNCTIONS
+ * ============================================================================ */
+
+/*
+ * Handler latencies are read from the CPU cycle counter and kept in a
+ * log-linear histogram: 16 linear sub-buckets per power of two, so any
+ * recorded value is within ~6% of its bucket. Values are in nanoseconds
+ * and clamp at 2^40 ns. Recording is a couple of relaxed atomic adds.
+ */
+
+static double g_cycles_per_ns = 1.0;
+static pthread_once_t g_cycles_once = PTHREAD_ONCE_INIT;
+
+static inline uint64_t goon_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static uint64_t goon_monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void goon_cycles_calibrate_once(void) {
+    uint64_t ns_start = goon_monotonic_ns();
+    uint64_t cycles_start = goon_cycles();
+    
+    struct timespec pause = {0, 5000000};
+    nanosleep(&pause, NULL);
+    
+    uint64_t ns = goon_monotonic_ns() - ns_start;
+    uint64_t cycles = goon_cycles() - cycles_start;
+    if (ns > 0 && cycles > 0) {
+        g_cycles_per_ns = (double)cycles / (double)ns;
+    }
+}
+
+static void goon_cycles_calibrate(void) {
+    pthread_once(&g_cycles_once, goon_cycles_calibrate_once);
+}
+
+static inline uint64_t goon_cycles_to_ns(uint64_t cycles) {
+    return (uint64_t)((double)cycles / g_cycles_per_ns);
+}
+
+static size_t goon_histogram_index(uint64_t value) {
+    if (value < GOON_HIST_SUB_COUNT) return (size_t)value;
+    
+    int msb = 63 - __builtin_clzll(value);
+    if (msb >= GOON_HIST_MAX_BITS) return GOON_HIST_BUCKETS - 1;
+    
+    int group = msb - GOON_HIST_SUB_BITS + 1;
+    return (size_t)group * GOON_HIST_SUB_COUNT +
+           (size_t)(value >> (msb - GOON_HIST_SUB_BITS)) - GOON_HIST_SUB_COUNT;
+}
+
+static uint64_t goon_histogram_value(size_t index) {
+    // Midpoint of the bucket
+    if (index < GOON_HIST_SUB_COUNT) return index;
+    
+    size_t group = index / GOON_HIST_SUB_COUNT;
+    uint64_t sub = index % GOON_HIST_SUB_COUNT + GOON_HIST_SUB_COUNT;
+    uint64_t width = 1ULL << (group - 1);
+    return sub * width + width / 2;
+}
+
+void goon_histogram_record(goon_histogram_t *hist, uint64_t value_ns) {
+    atomic_fetch_add_explicit(&hist->counts[goon_histogram_index(value_ns)], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&hist->total, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&hist->sum_ns, value_ns, memory_order_relaxed);
+    
+    uint64_t max = atomic_load_explicit(&hist->max_ns, memory_order_relaxed);
+    while (value_ns > max &&
+           !atomic_compare_exchange_weak_explicit(&hist->max_ns, &max, value_ns,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+uint64_t goon_histogram_percentile(goon_histogram_t *hist, double percentile) {
+    uint64_t total = atomic_load(&hist->total);
+    if (total == 0) return 0;
+    
+    uint64_t rank = (uint64_t)ceil(percentile / 100.0 * (double)total);
+    if (rank == 0) rank = 1;
+    
+    uint64_t seen = 0;
+    for (size_t i = 0; i < GOON_HIST_BUCKETS; i++) {
+        seen += atomic_load_explicit(&hist->counts[i], memory_order_relaxed);
+        if (seen >= rank) {
+            uint64_t value = goon_histogram_value(i);
+            uint64_t max = atomic_load(&hist->max_ns);
+            return value < max ? value : max;
+        }
+    }
+    
+    return atomic_load(&hist->max_ns);
+}
+
+void goon_histogram_reset(goon_histogram_t *hist) {
+    for (size_t i = 0; i < GOON_HIST_BUCKETS; i++) {
+        atomic_store_explicit(&hist->counts[i], 0, memory_order_relaxed);
+    }
+    atomic_store(&hist->total, 0);
+    atomic_store(&hist->sum_ns, 0);
+    atomic_store(&hist->max_ns, 0);
+}
+
+/* ============================================================================
+ * HANDLER MANAGEMENT FUNCTIONS
+ * ============================================================================ */
+
+goon_handler_t* goon_handler_create(const char *name, goon_handler_func func, void *user_data) {
+    if (!name || !func) {
+        GOON_ERROR_LOG("Invalid parameters for handler creation");
+        return NULL;
+    }
+    
+    goon_handler_t *handler = (goon_handler_t*)malloc(sizeof(goon_handler_t));
+    if (!handler) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_handler_t");
+        return NULL;
+    }
+    
+    handler->id = g_next_handler_id++;
+    strncpy(handler->name, name, GOON_MAX_NAME_LEN - 1);
+    handler->name[GOON_MAX_NAME_LEN - 1] = '\0';
+    handler->func = func;
+    handler->user_data = user_data;
+    handler->enabled = true;
+    atomic_init(&handler->call_count, 0);
+    atomic_init(&handler->error_count, 0);
+    atomic_init(&handler->latency, NULL);
+    handler->match_kind = GOON_MATCH_ALL;
+    handler->pattern[0] = '\0';
+    handler->route_rank = 0;
+    handler->route_slot = GOON_ROUTE_SLOT_NONE;
+    handler->order = 0;
+    handler->chain = 0;
+    atomic_init(&handler->drop_count, 0);
+    handler->name_sym = goon_symbol_intern(handler->name);
+    handler->after_count = 0;
+    handler->mutates = true;
+    handler->next = NULL;
+    
+    return handler;
+}
+
+// Run this handler after handler `name` whenever both see the same batch
+int goon_handler_depends_on(goon_handler_t *handler, const char *name) {
+    if (!handler || !name) return GOON_ERROR_NULL_PTR;
+    if (handler->after_count >= GOON_MAX_HANDLER_DEPS) return GOON_ERROR_OVERFLOW;
+    
+    goon_symbol_t sym = goon_symbol_intern(name);
+    if (sym == GOON_SYMBOL_NONE) return GOON_ERROR_OUT_OF_MEMORY;
+    
+    handler->after[handler->after_count++] = sym;
+    return GOON_SUCCESS;
+}
+
+/*
+ * Handlers are assumed to mutate events until declared otherwise. A
+ * read-only handler may run alongside others in a fan-out, so it must not
+ * return GOON_DROP or GOON_STOP_CHAIN or suspend the event either; such
+ * verdicts are counted as errors and ignored.
+ */
+void goon_handler_set_mutates(goon_handler_t *handler, bool mutates) {
+    if (handler) handler->mutates = mutates;
+}
+
+static bool goon_handler_depends(const goon_handler_t *handler, const goon_handler_t *other) {
+    for (size_t i = 0; i < handler->after_count; i++) {
+        if (handler->after[i] == other->name_sym) return true;
+    }
+    return false;
+}
+
+static goon_histogram_t* goon_handler_latency(goon_handler_t *handler) {
+    goon_histogram_t *hist = atomic_load_explicit(&handler->latency, memory_order_acquire);
+    if (hist) return hist;
+    
+    // Allocated on first sample; losing the install race frees our copy
+    hist = (goon_histogram_t*)calloc(1, sizeof(goon_histogram_t));
+    if (!hist) return NULL;
+    
+    goon_histogram_t *expected = NULL;
+    if (!atomic_compare_exchange_strong(&handler->latency, &expected, hist)) {
+        free(hist);
+        return expected;
+    }
+    return hist;
+}
+
+double goon_handler_avg_exec_ms(const goon_handler_t *handler) {
+    goon_histogram_t *hist = handler ? atomic_load(&handler->latency) : NULL;
+    uint64_t samples = hist ? atomic_load(&hist->total) : 0;
+    if (samples == 0) return 0.0;
+    return (double)atomic_load(&hist->sum_ns) / 1e6 / (double)samples;
+}
+
+uint64_t goon_handler_latency_percentile(const goon_handler_t *handler, double percentile) {
+    goon_histogram_t *hist = handler ? atomic_load(&handler->latency) : NULL;
+    return hist ? goon_histogram_percentile(hist, percentile) : 0;
+}
+
+void goon_handler_destroy(goon_handler_t *handler) {
+    if (!handler) return;
+    free(atomic_load(&handler->latency));
+    free(handler);
+}
+
+static void goon_handler_release(void *ptr) {
+    goon_handler_destroy((goon_handler_t*)ptr);
+}
+
+int goon_handler_enable(goon_handler_t *handler) {
+    if (!handler) return GOON_ERROR_NULL_PTR;
+    handler->enabled = true;
+    return GOON_SUCCESS;
+}
+
+int goon_handler_disable(goon_handler_t *handler) {
+    if (!handler) return GOON_ERROR_NULL_PTR;
+    handler->enabled = false;
+    return GOON_SUCCESS;
+}
+
+bool goon_handler_is_enabled(goon_handler_t *handler) {
+    if (!handler) return false;
+    return handler->enabled;
+}
+
+/* ============================================================================
+ * RCU RECLAMATION FUNCTIONS
+ * ============================================================================ */
+
+/*
+ * Epoch-based deferred freeing for data that dispatchers read without
+ * locks. A reader publishes the global epoch while inside
+ * goon_rcu_read_lock(); writers unlink an object first, then retire it
+ * with the epoch it was unlinked at. Retired objects are freed once every
+ * active reader entered after that epoch, so writers never wait on readers.
+ */
+
+static __thread goon_rcu_reader_t *g_rcu_self = NULL;
+static __thread uint32_t g_rcu_fallback = 0;
+
+static void goon_rcu_thread_exit(void *arg) {
+    goon_rcu_reader_t *reader = (goon_rcu_reader_t*)arg;
+    atomic_store(&reader->epoch, 0);
+    atomic_store_explicit(&reader->in_use, false, memory_order_release);
+}
+
+static void goon_rcu_create_key(void) {
+    pthread_key_create(&g_rcu.key, goon_rcu_thread_exit);
+}
+
+static goon_rcu_reader_t* goon_rcu_register(void) {
+    pthread_once(&g_rcu.once, goon_rcu_create_key);
+    
+    // Records are never unlinked; exited threads leave theirs for reuse
+    goon_rcu_reader_t *reader = atomic_load_explicit(&g_rcu.readers, memory_order_acquire);
+    for (; reader; reader = reader->next) {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&reader->in_use, &expected, true)) break;
+    }
+    
+    if (!reader) {
+        reader = (goon_rcu_reader_t*)calloc(1, sizeof(goon_rcu_reader_t));
+        if (!reader) return NULL;
+        
+        atomic_init(&reader->in_use, true);
+        reader->next = atomic_load(&g_rcu.readers);
+        while (!atomic_compare_exchange_weak(&g_rcu.readers, &reader->next, reader)) {
+        }
+    }
+    
+    reader->depth = 0;
+    pthread_setspecific(g_rcu.key, reader);
+    g_rcu_self = reader;
+    return reader;
+}
+
+static void goon_rcu_read_lock(void) {
+    goon_rcu_reader_t *self = g_rcu_self;
+    if (!self && (g_rcu_fallback > 0 || !(self = goon_rcu_register()))) {
+        // Without a record, hold back every reclamation instead
+        g_rcu_fallback++;
+        atomic_fetch_add(&g_rcu.anonymous, 1);
+        return;
+    }
+    
+    if (self->depth++ == 0) {
+        atomic_store(&self->epoch, atomic_load(&g_rcu.epoch));
+    }
+}
+
+static void goon_rcu_reclaim(bool wait);
+
+static void goon_rcu_read_unlock(void) {
+    if (g_rcu_fallback > 0) {
+        g_rcu_fallback--;
+        atomic_fetch_sub(&g_rcu.anonymous, 1);
+        return;
+    }
+    
+    goon_rcu_reader_t *self = g_rcu_self;
+    if (--self->depth > 0) return;
+    
+    atomic_store_explicit(&self->epoch, 0, memory_order_release);
+    if (atomic_load_explicit(&g_rcu.retired_count, memory_order_relaxed) > 0) {
+        goon_rcu_reclaim(false);
+    }
+}
+
+static void goon_rcu_reclaim(bool wait) {
+    if (wait) {
+        pthread_mutex_lock(&g_rcu.lock);
+    } else if (pthread_mutex_trylock(&g_rcu.lock) != 0) {
+        return;
+    }
+    
+    uint64_t oldest = UINT64_MAX;
+    if (atomic_load(&g_rcu.anonymous) > 0) oldest = 0;
+    
+    for (goon_rcu_reader_t *reader = atomic_load(&g_rcu.readers); reader; reader = reader->next) {
+        uint64_t epoch = atomic_load(&reader->epoch);
+        if (epoch != 0 && epoch < oldest) oldest = epoch;
+    }
+    
+    goon_rcu_retired_t *done = NULL;
+    goon_rcu_retired_t **link = &g_rcu.retired;
+    while (*link) {
+        goon_rcu_retired_t *item = *link;
+        if (item->epoch < oldest) {
+            *link = item->next;
+            item->next = done;
+            done = item;
+            atomic_fetch_sub_explicit(&g_rcu.retired_count, 1, memory_order_relaxed);
+        } else {
+            link = &item->next;
+        }
+    }
+    
+    pthread_mutex_unlock(&g_rcu.lock);
+    
+    while (done) {
+        goon_rcu_retired_t *next = done->next;
+        done->free(done->ptr);
+        free(done);
+        done = next;
+    }
+}
+
+// Free `ptr` once no reader can still see it; the caller has already unlinked it
+static void goon_rcu_retire(void *ptr, goon_free_func free_func) {
+    if (!ptr) return;
+    
+    goon_rcu_retired_t *item = (goon_rcu_retired_t*)malloc(sizeof(goon_rcu_retired_t));
+    if (!item) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_rcu_retired_t, leaking %p", ptr);
+        return;
+    }
+    
+    item->ptr = ptr;
+    item->free = free_func;
+    
+    pthread_mutex_lock(&g_rcu.lock);
+    item->epoch = atomic_fetch_add(&g_rcu.epoch, 1);
+    item->next = g_rcu.retired;
+    g_rcu.retired = item;
+    atomic_fetch_add_explicit(&g_rcu.retired_count, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&g_rcu.lock);
+    
+    goon_rcu_reclaim(false);
+}
+
+/* ============================================================================
+ * ROUTING INDEX FUNCTIONS
+ * ============================================================================ */
+
+/*
+ * Handlers subscribe to an exact name, a prefix ("sensor.*"), a glob
+ * ("*.error", "job.?.done") or everything. Exact names live in a hash
+ * table, prefixes in a byte trie, and globs in a list matched with
+ * fnmatch. Dispatch never touches these: it reads the published
+ * dispatch table, whose per-symbol routes are resolved from the index
+ * once and then served by a single array load.
+ */
+
+static int goon_route_list_add(goon_route_list_t *list, goon_handler_t *handler) {
+    if (list->count == list->capacity) {
+        size_t capacity = list->capacity ? list->capacity * 2 : 4;
+        goon_handler_t **items = (goon_handler_t**)realloc(list->items, capacity * sizeof(goon_handler_t*));
+        if (!items) return GOON_ERROR_OUT_OF_MEMORY;
+        list->items = items;
+        list->capacity = capacity;
+    }
+    
+    list->items[list->count++] = handler;
+    return GOON_SUCCESS;
+}
+
+static void goon_route_list_remove(goon_route_list_t *list, goon_handler_t *handler) {
+    for (size_t i = 0; i < list->count; i++) {
+        if (list->items[i] == handler) {
+            memmove(&list->items[i], &list->items[i + 1], (list->count - i - 1) * sizeof(goon_handler_t*));
+            list->count--;
+            return;
+        }
+    }
+}
+
+static bool goon_handler_runs_before(const goon_handler_t *a, const goon_handler_t *b) {
+    // Explicit order first; ties keep the historical newest-registered-first order
+    if (a->order != b->order) return a->order < b->order;
+    return a->route_rank > b->route_rank;
+}
+
+static int goon_route_compare_rank(const void *a, const void *b) {
+    const goon_handler_t *x = *(const goon_handler_t* const*)a;
+    const goon_handler_t *y = *(const goon_handler_t* const*)b;
+    if (x == y) return 0;
+    return goon_handler_runs_before(x, y) ? -1 : 1;
+}
+
+static int goon_route_table_init(goon_route_table_t *table) {
+    table->buckets = (goon_route_entry_t**)calloc(GOON_ROUTE_TABLE_INITIAL, sizeof(goon_route_entry_t*));
+    table->bucket_count = GOON_ROUTE_TABLE_INITIAL;
+    table->count = 0;
+    return table->buckets ? GOON_SUCCESS : GOON_ERROR_OUT_OF_MEMORY;
+}
+
+static void goon_route_entry_free(goon_route_entry_t *entry) {
+    while (entry) {
+        goon_route_entry_t *next = entry->next;
+        free(entry->handlers.items);
+        free(entry->name);
+        free(entry);
+        entry = next;
+    }
+}
+
+static goon_route_entry_t* goon_route_table_detach(goon_route_table_t *table) {
+    // Unlink every entry into a single chain and leave the table empty
+    goon_route_entry_t *chain = NULL;
+    for (size_t i = 0; i < table->bucket_count; i++) {
+        goon_route_entry_t *entry = table->buckets[i];
+        while (entry) {
+            goon_route_entry_t *next = entry->next;
+            entry->next = chain;
+            chain = entry;
+            entry = next;
+        }
+        table->buckets[i] = NULL;
+    }
+    table->count = 0;
+    return chain;
+}
+
+static goon_route_entry_t* goon_route_table_find(goon_route_table_t *table, const char *name, uint64_t hash) {
+    goon_route_entry_t *entry = table->buckets[hash & (table->bucket_count - 1)];
+    while (entry) {
+        if (entry->hash == hash && strcmp(entry->name, name) == 0) {
+            return entry;
+        }
+        entry = entry->next;
+    }
+    return NULL;
+}
+
+static goon_route_entry_t* goon_route_table_insert(goon_route_table_t *table, const char *name, uint64_t hash) {
+    goon_route_entry_t *entry = goon_route_table_find(table, name, hash);
+    if (entry) return entry;
+    
+    if (table->count >= table->bucket_count) {
+        size_t bucket_count = table->bucket_count * 2;
+        goon_route_entry_t **buckets = (goon_route_entry_t**)calloc(bucket_count, sizeof(goon_route_entry_t*));
+        if (buckets) {
+            for (size_t i = 0; i < table->bucket_count; i++) {
+                goon_route_entry_t *moved = table->buckets[i];
+                while (moved) {
+                    goon_route_entry_t *next = moved->next;
+                    size_t slot = moved->hash & (bucket_count - 1);
+                    moved->next = buckets[slot];
+                    buckets[slot] = moved;
+                    moved = next;
+                }
+            }
+            free(table->buckets);
+            table->buckets = buckets;
+            table->bucket_count = bucket_count;
+        }
+    }
+    
+    entry = (goon_route_entry_t*)calloc(1, sizeof(goon_route_entry_t));
+    if (!entry) return NULL;
+    
+    entry->name = strdup(name);
+    if (!entry->name) {
+        free(entry);
+        return NULL;
+    }
+    
+    size_t slot = hash & (table->bucket_count - 1);
+    entry->hash = hash;
+    entry->next = table->buckets[slot];
+    table->buckets[slot] = entry;
+    table->count++;
+    
+    return entry;
+}
+
+static void goon_route_node_free(goon_route_node_t *node) {
+    goon_route_node_t *child = node->child;
+    while (child) {
+        goon_route_node_t *next = child->sibling;
+        goon_route_node_free(child);
+        free(child);
+        child = next;
+    }
+    free(node->handlers.items);
+}
+
+static goon_route_node_t* goon_route_node_walk(goon_route_node_t *node, const char *prefix, size_t len, bool create) {
+    for (size_t i = 0; i < len && node; i++) {
+        unsigned char key = (unsigned char)prefix[i];
+        goon_route_node_t *child = node->child;
+        
+        while (child && child->key != key) {
+            child = child->sibling;
+        }
+        
+        if (!child && create) {
+            child = (goon_route_node_t*)calloc(1, sizeof(goon_route_node_t));
+            if (!child) return NULL;
+            child->key = key;
+            child->sibling = node->child;
+            node->child = child;
+        }
+        
+        node = child;
+    }
+    
+    return node;
+}
+
+goon_router_t* goon_router_create(void) {
+    goon_router_t *router = (goon_router_t*)calloc(1, sizeof(goon_router_t));
+    if (!router) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_router_t");
+        return NULL;
+    }
+    
+    if (goon_route_table_init(&router->exact) != GOON_SUCCESS) {
+        GOON_ERROR_LOG("Failed to allocate routing tables");
+        free(router);
+        return NULL;
+    }
+    
+    atomic_init(&router->table, NULL);
+    pthread_mutex_init(&router->lock, NULL);
+    return router;
+}
+
+static void goon_dispatch_table_free(void *ptr) {
+    goon_dispatch_table_t *table = (goon_dispatch_table_t*)ptr;
+    for (size_t i = 0; i < table->route_capacity; i++) {
+        free(atomic_load_explicit(&table->routes[i], memory_order_relaxed));
+    }
+    free(table->routes);
+    free(table);
+}
+
+// No dispatch may be in flight
+void goon_router_destroy(goon_router_t *router) {
+    if (!router) return;
+    
+    goon_dispatch_table_t *table = atomic_load(&router->table);
+    if (table) goon_dispatch_table_free(table);
+    
+    goon_route_entry_free(goon_route_table_detach(&router->exact));
+    free(router->exact.buckets);
+    goon_route_node_free(&router->prefixes);
+    free(router->globs.items);
+    free(router->wildcard.items);
+    free(router->handlers.items);
+    pthread_mutex_destroy(&router->lock);
+    free(router);
+}
+
+/*
+ * Build a dispatch table from the current subscriptions and swap it in.
+ * Entries are laid out in run order, so a route is a sorted list of entry
+ * slots. Routes start empty and are filled per symbol on first use. The
+ * previous table is retired, not freed. Caller holds router->lock.
+ */
+static void goon_router_publish(goon_router_t *router) {
+    size_t count = router->handlers.count;
+    qsort(router->handlers.items, count, sizeof(goon_handler_t*), goon_route_compare_rank);
+    
+    size_t capacity = GOON_ROUTE_TABLE_INITIAL;
+    while (capacity <= goon_symbol_count() * 2) capacity *= 2;
+    
+    goon_dispatch_table_t *table = (goon_dispatch_table_t*)calloc(1, sizeof(goon_dispatch_table_t) +
+                                                                  count * sizeof(goon_dispatch_entry_t));
+    _Atomic(goon_route_t*) *routes = (_Atomic(goon_route_t*)*)calloc(capacity, sizeof(_Atomic(goon_route_t*)));
+    
+    if (!table || !routes) {
+        // Publishing nothing is safe; keeping a table that names removed handlers is not
+        GOON_ERROR_LOG("Failed to build dispatch table, routing disabled until the next change");
+        free(table);
+        free(routes);
+        table = NULL;
+    } else {
+        table->entries = (goon_dispatch_entry_t*)(table + 1);
+        table->entry_count = count;
+        table->routes = routes;
+        table->route_capacity = capacity;
+        atomic_init(&table->route_count, 0);
+        table->version = ++router->version;
+        
+        for (size_t i = 0; i < count; i++) {
+            goon_handler_t *handler = router->handlers.items[i];
+            table->entries[i].func = handler->func;
+            table->entries[i].user_data = handler->user_data;
+            table->entries[i].handler = handler;
+            handler->route_slot = (uint32_t)i;
+        }
+    }
+    
+    goon_dispatch_table_t *old = atomic_exchange(&router->table, table);
+    goon_rcu_retire(old, goon_dispatch_table_free);
+}
+
+static goon_match_kind_t goon_match_classify(const char *pattern) {
+    if (!pattern || pattern[0] == '\0' || strcmp(pattern, "*") == 0) {
+        return GOON_MATCH_ALL;
+    }
+    
+    size_t len = strlen(pattern);
+    size_t literal = strcspn(pattern, "*?[\\");
+    
+    if (literal == len) return GOON_MATCH_EXACT;
+    if (literal == len - 1 && pattern[len - 1] == '*') return GOON_MATCH_PREFIX;
+    return GOON_MATCH_GLOB;
+}
+
+int goon_router_add(goon_router_t *router, goon_handler_t *handler) {
+    if (!router || !handler) return GOON_ERROR_NULL_PTR;
+    
+    goon_route_list_t *list = NULL;
+    pthread_mutex_lock(&router->lock);
+    
+    switch (handler->match_kind) {
+        case GOON_MATCH_EXACT: {
+            goon_route_entry_t *entry = goon_route_table_insert(&router->exact, handler->pattern,
+                                                                goon_hash_string(handler->pattern));
+            list = entry ? &entry->handlers : NULL;
+            break;
+        }
+        case GOON_MATCH_PREFIX: {
+            goon_route_node_t *node = goon_route_node_walk(&router->prefixes, handler->pattern,
+                                                           strlen(handler->pattern) - 1, true);
+            list = node ? &node->handlers : NULL;
+            break;
+        }
+        case GOON_MATCH_GLOB:
+            list = &router->globs;
+            break;
+        default:
+            list = &router->wildcard;
+            break;
+    }
+    
+    if (!list || goon_route_list_add(list, handler) != GOON_SUCCESS) {
+        pthread_mutex_unlock(&router->lock);
+        GOON_ERROR_LOG("Failed to index subscription '%s' for handler '%s'", handler->pattern, handler->name);
+        return GOON_ERROR_OUT_OF_MEMORY;
+    }
+    
+    if (goon_route_list_add(&router->handlers, handler) != GOON_SUCCESS) {
+        goon_route_list_remove(list, handler);
+        pthread_mutex_unlock(&router->lock);
+        GOON_ERROR_LOG("Failed to index subscription '%s' for handler '%s'", handler->pattern, handler->name);
+        return GOON_ERROR_OUT_OF_MEMORY;
+    }
+    
+    router->subscriptions[handler->match_kind]++;
+    goon_router_publish(router);
+    pthread_mutex_unlock(&router->lock);
+    return GOON_SUCCESS;
+}
+
+// The handler stays reachable by in-flight dispatches until an RCU grace period passes
+void goon_router_remove(goon_router_t *router, goon_handler_t *handler) {
+    if (!router || !handler) return;
+    
+    goon_route_list_t *list = NULL;
+    pthread_mutex_lock(&router->lock);
+    
+    switch (handler->match_kind) {
+        case GOON_MATCH_EXACT: {
+            goon_route_entry_t *entry = goon_route_table_find(&router->exact, handler->pattern,
+                                                              goon_hash_string(handler->pattern));
+            list = entry ? &entry->handlers : NULL;
+            break;
+        }
+        case GOON_MATCH_PREFIX: {
+            goon_route_node_t *node = goon_route_node_walk(&router->prefixes, handler->pattern,
+                                                           strlen(handler->pattern) - 1, false);
+            list = node ? &node->handlers : NULL;
+            break;
+        }
+        case GOON_MATCH_GLOB:
+            list = &router->globs;
+            break;
+        default:
+            list = &router->wildcard;
+            break;
+    }
+    
+    if (list) {
+        goon_route_list_remove(list, handler);
+        router->subscriptions[handler->match_kind]--;
+    }
+    goon_route_list_remove(&router->handlers, handler);
+    handler->route_slot = GOON_ROUTE_SLOT_NONE;
+    goon_router_publish(router);
+    pthread_mutex_unlock(&router->lock);
+}
+
+void goon_router_refresh(goon_router_t *router) {
+    if (!router) return;
+    
+    pthread_mutex_lock(&router->lock);
+    goon_router_publish(router);
+    pthread_mutex_unlock(&router->lock);
+}
+
+static int goon_route_compare_slot(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+// Caller holds router->lock and `table` is the published one
+static goon_route_t* goon_router_build_route(goon_router_t *router, const goon_dispatch_table_t *table,
+                                             goon_symbol_t sym) {
+    const char *name = goon_symbol_name(sym);
+    uint64_t hash = goon_symbol_hash(sym);
+    goon_route_list_t matches = {0};
+    
+    goon_route_entry_t *exact = goon_route_table_find(&router->exact, name, hash);
+    if (exact) {
+        for (size_t i = 0; i < exact->handlers.count; i++) {
+            goon_route_list_add(&matches, exact->handlers.items[i]);
+        }
+    }
+    
+    // Every trie node on the name's path is a matching prefix
+    goon_route_node_t *node = &router->prefixes;
+    for (const char *p = name; node; p++) {
+        for (size_t i = 0; i < node->handlers.count; i++) {
+            goon_route_list_add(&matches, node->handlers.items[i]);
+        }
+        if (*p == '\0') break;
+        node = goon_route_node_walk(node, p, 1, false);
+    }
+    
+    for (size_t i = 0; i < router->globs.count; i++) {
+        if (fnmatch(router->globs.items[i]->pattern, name, 0) == 0) {
+            goon_route_list_add(&matches, router->globs.items[i]);
+        }
+    }
+    
+    for (size_t i = 0; i < router->wildcard.count; i++) {
+        goon_route_list_add(&matches, router->wildcard.items[i]);
+    }
+    
+    goon_route_t *route = (goon_route_t*)malloc(sizeof(goon_route_t) + matches.count * sizeof(uint32_t));
+    if (route) {
+        route->count = 0;
+        for (size_t i = 0; i < matches.count; i++) {
+            uint32_t slot = matches.items[i]->route_slot;
+            if (slot < table->entry_count && table->entries[slot].handler == matches.items[i]) {
+                route->slots[route->count++] = slot;
+            }
+        }
+        qsort(route->slots, route->count, sizeof(uint32_t), goon_route_compare_slot);
+    }
+    
+    free(matches.items);
+    return route;
+}
+
+static const goon_route_t g_route_none = { .count = 0 };
+
+/*
+ * Route `sym` through `table`, which the caller reached inside an RCU read
+ * section. Cached routes are a lock-free array load. A miss takes the
+ * router lock to fill the slot; NULL means `table` was replaced meanwhile
+ * and the caller should retry on the current one.
+ */
+const goon_route_t* goon_router_resolve(goon_router_t *router, goon_dispatch_table_t *table, goon_symbol_t sym) {
+    if (!router || !table) return &g_route_none;
+    
+    if (sym < table->route_capacity) {
+        goon_route_t *route = atomic_load_explicit(&table->routes[sym], memory_order_acquire);
+        if (route) return route;
+    }
+    
+    pthread_mutex_lock(&router->lock);
+    
+    if (atomic_load_explicit(&router->table, memory_order_relaxed) != table) {
+        pthread_mutex_unlock(&router->lock);
+        return NULL;
+    }
+    
+    router->route_misses++;
+    
+    if (sym >= table->route_capacity) {
+        // Interned after the table was sized: republish with room for it
+        goon_router_publish(router);
+        pthread_mutex_unlock(&router->lock);
+        return NULL;
+    }
+    
+    goon_route_t *route = atomic_load_explicit(&table->routes[sym], memory_order_relaxed);
+    if (!route) {
+        route = goon_router_build_route(router, table, sym);
+        if (route) {
+            atomic_store_explicit(&table->routes[sym], route, memory_order_release);
+            atomic_fetch_add_explicit(&table->route_count, 1, memory_order_relaxed);
+        } else {
+            GOON_ERROR_LOG("Failed to cache route for symbol %u", sym);
+        }
+    }
+    
+    pthread_mutex_unlock(&router->lock);
+    return route ? route : &g_route_none;
+}
+
+/* ============================================================================
+ * CONTEXT MANAGEMENT FUNCTIONS
+ * ============================================================================ */
+
+goon_context_t* goon_context_create(const char *name) {
+    goon_context_t *ctx = (goon_context_t*)malloc(sizeof(goon_context_t));
+    if (!ctx) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_context_t");
+        return NULL;
+    }
+    
+    ctx->id = g_next_context_id++;
+    strncpy(ctx->name, name ? name : "default", GOON_MAX_NAME_LEN - 1);
+    ctx->name[GOON_MAX_NAME_LEN - 1] = '\0';
+    ctx->state = GOON_STATE_IDLE;
+    ctx->handlers = NULL;
+    ctx->handler_count = 0;
+    ctx->router = goon_router_create();
+    ctx->next_route_rank = 0;
+    ctx->chains[0] = GOON_SYMBOL_NONE;
+    ctx->chain_count = 1;
+    ctx->fanout = false;
+    ctx->timing_mode = GOON_TIMING_COMPILED ? GOON_TIMING_SAMPLED : GOON_TIMING_OFF;
+    ctx->timing_sample_rate = GOON_TIMING_SAMPLE_RATE;
+    goon_cycles_calibrate();
+    ctx->event_queue = goon_queue_create_lanes(GOON_MAX_QUEUE_SIZE, GOON_QUEUE_MODE_LIST,
+                                               GOON_DRAIN_STRICT);
+    ctx->call_stack = goon_stack_create(GOON_MAX_STACK_SIZE);
+    ctx->cache = goon_cache_create();
+    ctx->memory_pool = goon_pool_create(GOON_POOL_SIZE, NULL, NULL);
+    ctx->event_slab = goon_event_slab_create(GOON_CACHE_LINE);  // one line-aligned slot per event
+    ctx->arena_mode = false;
+    memset(ctx->arenas, 0, sizeof(ctx->arenas));
+    ctx->arena_active = 0;
+    pthread_mutex_init(&ctx->arena_lock, NULL);
+    ctx->queue_mode = GOON_QUEUE_MODE_LIST;
+    ctx->drain_policy = GOON_DRAIN_STRICT;
+    ctx->queue_capacity = GOON_MAX_QUEUE_SIZE;
+    ctx->queue_memory_limit = 0;
+    ctx->timers = goon_timer_wheel_create();
+    ctx->coalesce_mode = GOON_COALESCE_OFF;
+    ctx->merge_func = NULL;
+    ctx->merge_user_data = NULL;
+    ctx->coalesce_index = goon_coalesce_index_create(GOON_COALESCE_INITIAL_SIZE);
+    pthread_mutex_init(&ctx->coalesce_lock, NULL);
+    atomic_init(&ctx->coalesced_count, 0);
+    atomic_init(&ctx->event_count, 0);
+    atomic_init(&ctx->total_events_processed, 0);
+    ctx->start_time = time(NULL);
+    ctx->user_data = NULL;
+    ctx->debug_mode = false;
+    pthread_mutex_init(&ctx->async_lock, NULL);
+    ctx->async_head = NULL;
+    ctx->async_tail = NULL;
+    atomic_init(&ctx->async_ready, 0);
+    atomic_init(&ctx->async_suspended, 0);
+    ctx->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    atomic_init(&ctx->wake_pending, false);
+    if (ctx->wake_fd < 0) {
+        GOON_WARN("eventfd unavailable (%s), idle workers will poll", strerror(errno));
+    }
+    ctx->overflow_policy = GOON_OVERFLOW_REJECT;
+    ctx->overflow_timeout_ms = -1;
+    ctx->spill_head = NULL;
+    ctx->spill_tail = NULL;
+    ctx->disk_queue = NULL;
+    ctx->persistent = false;
+    atomic_init(&ctx->spill_count, 0);
+    atomic_init(&ctx->space_waiters, 0);
+    atomic_init(&ctx->overflow_warned, false);
+    memset(&ctx->backpressure, 0, sizeof(ctx->backpressure));
+    
+    pthread_condattr_t cond_attr;
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&ctx->space_lock, NULL);
+    pthread_cond_init(&ctx->space_cond, &cond_attr);
+    pthread_condattr_destroy(&cond_attr);
+    
+    if (!ctx->event_queue || !ctx->call_stack || !ctx->cache || !ctx->memory_pool || !ctx->event_slab ||
+        !ctx->timers || !ctx->coalesce_index || !ctx->router) {
+        GOON_ERROR_LOG("Failed to initialize context components");
+        goon_context_destroy(ctx);
+        return NULL;
+    }
+    
+    return ctx;
+}
+
+void goon_context_destroy(goon_context_t *ctx) {
+    if (!ctx) return;
+    
+    goon_handler_t *handler = ctx->handlers;
+    while (handler) {
+        goon_handler_t *next = handler->next;
+        goon_handler_destroy(handler);
+        handler = next;
+    }
+    
+    goon_router_destroy(ctx->router);
+    
+    if (ctx->event_queue) {
+        goon_queue_destroy(ctx->event_queue);
+    }
+    
+    if (ctx->call_stack) {
+        goon_stack_destroy(ctx->call_stack);
+    }
+    
+    if (ctx->cache) {
+        goon_cache_destroy(ctx->cache);
+    }
+    
+    if (ctx->timers) {
+        goon_timer_wheel_destroy(ctx->timers);
+    }
+    
+    if (ctx->coalesce_index) {
+        goon_coalesce_index_destroy(ctx->coalesce_index);
+    }
+    pthread_mutex_destroy(&ctx->coalesce_lock);
+    
+    goon_event_t *spilled = ctx->spill_head;
+    while (spilled) {
+        goon_event_t *next = spilled->next;
+        goon_event_destroy(spilled);
+        spilled = next;
+    }
+    
+    // No commit here: whatever was still queued was never dispatched and
+    // must be recovered by the next open
+    if (ctx->disk_queue) {
+        goon_disk_queue_close(ctx->disk_queue);
+    }
+    
+    pthread_cond_destroy(&ctx->space_cond);
+    pthread_mutex_destroy(&ctx->space_lock);
+    
+    size_t waiting = atomic_load(&ctx->async_suspended) - atomic_load(&ctx->async_ready);
+    if (waiting > 0) {
+        GOON_WARN("Context '%s' destroyed with %zu suspended events; their tokens are now invalid", ctx->name, waiting);
+    }
+    goon_async_t *token = ctx->async_head;
+    while (token) {
+        goon_async_t *next = token->next;
+        goon_event_destroy(token->event);
+        free(token);
+        token = next;
+    }
+    pthread_mutex_destroy(&ctx->async_lock);
+    
+    // Timers, spilled events and parked tokens may still hold pool payloads
+    if (ctx->memory_pool) {
+        goon_pool_destroy(ctx->memory_pool);
+    }
+    
+    if (ctx->wake_fd >= 0) {
+        close(ctx->wake_fd);
+    }
+    
+    // Free whatever this context retired that no other reader still holds
+    goon_rcu_reclaim(true);
+    
+    for (int i = 0; i < 2; i++) {
+        size_t live = atomic_load(&ctx->arenas[i].live);
+        if (live > 0) {
+            GOON_WARN("Context '%s' destroyed with %zu live arena objects", ctx->name, live);
+        }
+        goon_arena_destroy(&ctx->arenas[i]);
+    }
+    pthread_mutex_destroy(&ctx->arena_lock);
+    
+    // Slab memory outlives the context until other threads drop their magazines
+    if (ctx->event_slab) {
+        goon_event_slab_detach(ctx->event_slab);
+        goon_event_slab_release(ctx->event_slab);
+    }
+    
+    free(ctx);
+}
+
+/*
+ * Register a handler that only receives events whose name matches
+ * `pattern`: an exact name, a prefix ending in '*', or an fnmatch glob.
+ * NULL, "" or "*" subscribe to every event.
+ */
+int goon_context_subscribe(goon_context_t *ctx, goon_handler_t *handler, const char *pattern) {
+    if (!ctx || !handler) return GOON_ERROR_NULL_PTR;
+    
+    handler->match_kind = goon_match_classify(pattern);
+    strncpy(handler->pattern, handler->match_kind == GOON_MATCH_ALL ? "*" : pattern, GOON_MAX_NAME_LEN - 1);
+    handler->pattern[GOON_MAX_NAME_LEN - 1] = '\0';
+    handler->route_rank = ctx->next_route_rank++;
+    
+    int result = goon_router_add(ctx->router, handler);
+    if (result != GOON_SUCCESS) return result;
+    
+    handler->next = ctx->handlers;
+    ctx->handlers = handler;
+    ctx->handler_count++;
+    
+    GOON_INFO("Registered handler '%s' (ID: %u) for '%s'", handler->name, handler->id, handler->pattern);
+    return GOON_SUCCESS;
+}
+
+int goon_context_register_handler(goon_context_t *ctx, goon_handler_t *handler) {
+    return goon_context_subscribe(ctx, handler, NULL);
+}
+
+goon_handler_t* goon_context_find_handler(goon_context_t *ctx, const char *name) {
+    if (!ctx || !name) return NULL;
+    
+    goon_handler_t *handler = ctx->handlers;
+    while (handler) {
+        if (strcmp(handler->name, name) == 0) {
+            return handler;
+        }
+        handler = handler->next;
+    }
+    
+    return NULL;
+}
+
+/*
+ * Handlers run in ascending order; equal orders keep the default
+ * newest-registered-first order. A handler returning GOON_DROP skips the
+ * event for every later handler, GOON_STOP_CHAIN only for later handlers
+ * in its own chain.
+ */
+int goon_context_set_handler_order(goon_context_t *ctx, const char *name, int order) {
+    if (!ctx || !name) return GOON_ERROR_NULL_PTR;
+    
+    goon_handler_t *handler = goon_context_find_handler(ctx, name);
+    if (!handler) return GOON_ERROR_NOT_FOUND;
+    
+    handler->order = order;
+    goon_router_refresh(ctx->router);
+    return GOON_SUCCESS;
+}
+
+static int goon_context_chain_index(goon_context_t *ctx, const char *chain) {
+    if (!chain || chain[0] == '\0') return 0;
+    
+    goon_symbol_t sym = goon_symbol_intern(chain);
+    for (size_t i = 1; i < ctx->chain_count; i++) {
+        if (ctx->chains[i] == sym) return (int)i;
+    }
+    
+    if (ctx->chain_count >= GOON_MAX_CHAINS) {
+        GOON_ERROR_LOG("Context '%s' has too many handler chains", ctx->name);
+        return -1;
+    }
+    
+    ctx->chains[ctx->chain_count] = sym;
+    return (int)ctx->chain_count++;
+}
+
+int goon_context_set_handler_chain(goon_context_t *ctx, const char *name, const char *chain) {
+    if (!ctx || !name) return GOON_ERROR_NULL_PTR;
+    
+    goon_handler_t *handler = goon_context_find_handler(ctx, name);
+    if (!handler) return GOON_ERROR_NOT_FOUND;
+    
+    int index = goon_context_chain_index(ctx, chain);
+    if (index < 0) return GOON_ERROR_OVERFLOW;
+    
+    handler->chain = (uint8_t)index;
+    return GOON_SUCCESS;
+}
+
+const char* goon_context_get_chain_name(goon_context_t *ctx, uint8_t chain) {
+    if (!ctx || chain == 0 || chain >= ctx->chain_count) return "default";
+    return goon_symbol_name(ctx->chains[chain]);
+}
+
+// Subscribe handlers to `pattern` as one chain that runs them in array order
+int goon_context_register_chain(goon_context_t *ctx, const char *chain, const char *pattern,
+                                goon_handler_t **handlers, size_t count) {
+    if (!ctx || !handlers) return GOON_ERROR_NULL_PTR;
+    
+    int index = goon_context_chain_index(ctx, chain);
+    if (index < 0) return GOON_ERROR_OVERFLOW;
+    
+    for (size_t i = 0; i < count; i++) {
+        handlers[i]->chain = (uint8_t)index;
+        handlers[i]->order = (int)i;
+        
+        int result = goon_context_subscribe(ctx, handlers[i], pattern);
+        if (result != GOON_SUCCESS) return result;
+    }
+    
+    return GOON_SUCCESS;
+}
+
+int goon_context_unregister_handler(goon_context_t *ctx, const char *name) {
+    if (!ctx || !name) return GOON_ERROR_NULL_PTR;
+    
+    goon_handler_t *prev = NULL;
+    goon_handler_t *handler = ctx->handlers;
+    
+    while (handler) {
+        if (strcmp(handler->name, name) == 0) {
+            if (prev) {
+                prev->next = handler->next;
+            } else {
+                ctx->handlers = handler->next;
+            }
+            
+            // Dispatches already holding the old table may still call it
+            goon_router_remove(ctx->router, handler);
+            goon_rcu_retire(handler, goon_handler_release);
+            ctx->handler_count--;
+            GOON_INFO("Unregistered handler '%s'", name);
+            return GOON_SUCCESS;
+        }
+        
+        prev = handler;
+        handler = handler->next;
+    }
+    
+    return GOON_ERROR_NOT_FOUND;
+}
+
+int goon_context_set_state(goon_context_t *ctx, goon_state_t state) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    
+    ctx->state = state;
+    GOON_DEBUG("Context '%s' state changed to %d", ctx->name, state);
+    return GOON_SUCCESS;
+}
+
+goon_state_t goon_context_get_state(goon_context_t *ctx) {
+    if (!ctx) return GOON_STATE_ERROR;
+    return ctx->state;
+}
+
+static int goon_context_rebuild_queue(goon_context_t *ctx, goon_queue_mode_t mode,
+                                      goon_drain_policy_t policy, size_t capacity) {
+    // Swapping the queue is only safe while nothing is queued or in flight
+    if (ctx->state == GOON_STATE_RUNNING || !goon_queue_is_empty(ctx->event_queue)) {
+        GOON_WARN("Cannot rebuild queue while events are pending");
+        return GOON_ERROR;
+    }
+    
+    goon_queue_t *queue = goon_queue_create_lanes(capacity, mode, policy);
+    if (!queue) return GOON_ERROR_OUT_OF_MEMORY;
+    
+    goon_queue_set_memory_limit(queue, ctx->queue_memory_limit);
+    goon_queue_destroy(ctx->event_queue);
+    ctx->event_queue = queue;
+    ctx->queue_mode = mode;
+    ctx->drain_policy = policy;
+    ctx->queue_capacity = capacity;
+    
+    return GOON_SUCCESS;
+}
+
+int goon_context_set_queue_mode(goon_context_t *ctx, goon_queue_mode_t mode) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    
+    // Lanes are selected through the drain policy, not the backend
+    if (mode == GOON_QUEUE_MODE_LANES) return GOON_ERROR_INVALID_PARAM;
+    if (ctx->queue_mode == mode) return GOON_SUCCESS;
+    
+    int result = goon_context_rebuild_queue(ctx, mode, ctx->drain_policy, ctx->queue_capacity);
+    if (result == GOON_SUCCESS) {
+        GOON_INFO("Context '%s' queue mode set to %d", ctx->name, mode);
+    }
+    
+    return result;
+}
+
+int goon_context_set_drain_policy(goon_context_t *ctx, goon_drain_policy_t policy) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    if (ctx->drain_policy == policy) return GOON_SUCCESS;
+    
+    // Switching between strict and weighted keeps the existing lanes
+    if (policy != GOON_DRAIN_FIFO && ctx->drain_policy != GOON_DRAIN_FIFO) {
+        goon_queue_set_drain_policy(ctx->event_queue, policy);
+        ctx->drain_policy = policy;
+        return GOON_SUCCESS;
+    }
+    
+    int result = goon_context_rebuild_queue(ctx, ctx->queue_mode, policy, ctx->queue_capacity);
+    if (result == GOON_SUCCESS) {
+        GOON_INFO("Context '%s' drain policy set to %d", ctx->name, policy);
+    }
+    
+    return result;
+}
+
+int goon_context_set_queue_capacity(goon_context_t *ctx, size_t capacity) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    if (capacity == 0) return GOON_ERROR_INVALID_PARAM;
+    if (ctx->queue_capacity == capacity) return GOON_SUCCESS;
+    
+    int result = goon_context_rebuild_queue(ctx, ctx->queue_mode, ctx->drain_policy, capacity);
+    if (result == GOON_SUCCESS) {
+        GOON_INFO("Context '%s' queue capacity set to %zu", ctx->name, capacity);
+    }
+    
+    return result;
+}
+
+int goon_context_set_queue_memory_limit(goon_context_t *ctx, size_t bytes) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    
+    // A soft limit can change at any time; it only gates future pushes
+    ctx->queue_memory_limit = bytes;
+    return goon_queue_set_memory_limit(ctx->event_queue, bytes);
+}
+
+/* ============================================================================
+ * EVENT PROCESSING FUNCTIONS
+ * ============================================================================ */
+
+static void goon_context_unindex(goon_context_t *ctx, goon_event_t **events, size_t count);
+
+static void goon_context_spill(goon_context_t *ctx, goon_event_t *event) {
+    if (ctx->disk_queue) {
+        // The event is about to be serialised and freed
+        goon_context_unindex(ctx, &event, 1);
+    }
+    
+    pthread_mutex_lock(&ctx->space_lock);
+    
+    if (ctx->disk_queue && !ctx->spill_head &&
+        goon_disk_queue_append(ctx->disk_queue, event) == GOON_SUCCESS) {
+        goon_event_destroy(event);
+        event = NULL;
+    } else if (ctx->disk_queue) {
+        GOON_WARN("Disk spill failed for event '%s', keeping it in memory", goon_event_get_name(event));
+    }
+    
+    if (event) {
+        event->next = NULL;
+        if (ctx->spill_tail) {
+            ctx->spill_tail->next = event;
+        } else {
+            ctx->spill_head = event;
+        }
+        ctx->spill_tail = event;
+    }
+    
+    size_t depth = atomic_fetch_add(&ctx->spill_count, 1) + 1;
+    if (depth > atomic_load_explicit(&ctx->backpressure.spill_high_water, memory_order_relaxed)) {
+        atomic_store_explicit(&ctx->backpressure.spill_high_water, depth, memory_order_relaxed);
+    }
+    
+    pthread_mutex_unlock(&ctx->space_lock);
+    atomic_fetch_add_explicit(&ctx->backpressure.spilled, 1, memory_order_relaxed);
+}
+
+static void goon_context_unspill(goon_context_t *ctx) {
+    pthread_mutex_lock(&ctx->space_lock);
+    
+    // Move spilled events back in order until the queue is full again
+    while (ctx->spill_head) {
+        goon_event_t *event = ctx->spill_head;
+        goon_event_t *next = event->next;
+        
+        if (goon_queue_try_push(ctx->event_queue, event) != GOON_SUCCESS) {
+            event->next = next;
+            break;
+        }
+        
+        ctx->spill_head = next;
+        atomic_fetch_sub(&ctx->spill_count, 1);
+        atomic_fetch_add_explicit(&ctx->backpressure.unspilled, 1, memory_order_relaxed);
+    }
+    
+    if (!ctx->spill_head) {
+        ctx->spill_tail = NULL;
+    }
+    
+    // Then read back from disk, in order, while the queue has room
+    while (!ctx->spill_head && ctx->disk_queue) {
+        goon_event_t *event = goon_disk_queue_peek(ctx->disk_queue);
+        if (!event) break;
+        
+        if (goon_queue_try_push(ctx->event_queue, event) != GOON_SUCCESS) {
+            goon_event_destroy(event);
+            break;
+        }
+        
+        goon_disk_queue_advance(ctx->disk_queue);
+        atomic_fetch_sub(&ctx->spill_count, 1);
+        atomic_fetch_add_explicit(&ctx->backpressure.unspilled, 1, memory_order_relaxed);
+    }
+    
+    pthread_mutex_unlock(&ctx->space_lock);
+}
+
+static void goon_context_commit_spill(goon_context_t *ctx) {
+    if (!ctx->disk_queue) return;
+    
+    // Records still sitting in the event queue were read back but not yet
+    // dispatched; committing past them would lose them in a crash
+    pthread_mutex_lock(&ctx->space_lock);
+    if (goon_queue_is_empty(ctx->event_queue)) {
+        goon_disk_queue_commit(ctx->disk_queue);
+    }
+    pthread_mutex_unlock(&ctx->space_lock);
+}
+
+/*
+ * Attach a disk-backed spill log in `dir`. Overflowing events under
+ * GOON_OVERFLOW_SPILL go to disk instead of memory. With `persistent`
+ * every emit is journaled first and only leaves the log once dispatched,
+ * so events survive a crash; any left by a previous run are recovered.
+ */
+int goon_context_attach_disk_queue(goon_context_t *ctx, const char *dir, bool persistent) {
+    if (!ctx || !dir) return GOON_ERROR_NULL_PTR;
+    if (ctx->disk_queue) return GOON_ERROR;
+    
+    goon_disk_queue_t *dq = goon_disk_queue_open(dir, GOON_DISK_SEGMENT_SIZE);
+    if (!dq) return GOON_ERROR;
+    
+    pthread_mutex_lock(&ctx->space_lock);
+    ctx->disk_queue = dq;
+    ctx->persistent = persistent;
+    atomic_fetch_add(&ctx->spill_count, goon_disk_queue_pending(dq));
+    pthread_mutex_unlock(&ctx->space_lock);
+    
+    GOON_INFO("Context '%s' attached disk queue '%s'%s", ctx->name, dir,
+              persistent ? " (persistent)" : "");
+    return GOON_SUCCESS;
+}
+
+static void goon_context_release_space(goon_context_t *ctx) {
+    // Pairs with the waiter increment in goon_context_wait_for_space
+    atomic_thread_fence(memory_order_seq_cst);
+    
+    if (atomic_load_explicit(&ctx->spill_count, memory_order_relaxed) > 0) {
+        goon_context_unspill(ctx);
+    }
+    
+    if (atomic_load_explicit(&ctx->space_waiters, memory_order_relaxed) > 0) {
+        pthread_mutex_lock(&ctx->space_lock);
+        pthread_cond_broadcast(&ctx->space_cond);
+        pthread_mutex_unlock(&ctx->space_lock);
+    }
+}
+
+static void goon_context_unindex(goon_context_t *ctx, goon_event_t **events, size_t count) {
+    bool indexed = false;
+    for (size_t i = 0; i < count && !indexed; i++) {
+        // Rehashing may move the slot, but never clears it without the lock
+        indexed = atomic_load_explicit(&events[i]->coalesce_slot, memory_order_relaxed) != 0;
+    }
+    if (!indexed) return;
+    
+    // Once unindexed under the lock, no producer can merge into the event
+    pthread_mutex_lock(&ctx->coalesce_lock);
+    for (size_t i = 0; i < count; i++) {
+        goon_coalesce_index_remove(ctx->coalesce_index, events[i]);
+    }
+    pthread_mutex_unlock(&ctx->coalesce_lock);
+}
+
+static goon_event_t* goon_context_next_event(goon_context_t *ctx) {
+    goon_event_t *event = goon_queue_pop(ctx->event_queue);
+    if (event) {
+        goon_context_unindex(ctx, &event, 1);
+        goon_context_release_space(ctx);
+    }
+    return event;
+}
+
+/*
+ * Look up `key` among queued events. On a hit the incoming payload is
+ * folded into the queued event and `event` is destroyed (GOON_SUCCESS).
+ * Otherwise GOON_ERROR_NOT_FOUND tells the caller to queue `event`. On a
+ * plain miss with `push` set, the event is indexed and pushed under the
+ * lock, so nothing can merge into an event the queue then rejects;
+ * `*queued` says whether the push went through. Without `push` (spilling)
+ * it is only indexed. A merge callback that returns an error leaves both
+ * events alone.
+ */
+static int goon_context_coalesce(goon_context_t *ctx, goon_event_t *event, const char *key,
+                                 bool push, bool *queued) {
+    bool merged = false;
+    *queued = false;
+    
+    pthread_mutex_lock(&ctx->coalesce_lock);
+    
+    goon_coalesce_entry_t *entry = goon_coalesce_index_find(ctx->coalesce_index, key,
+                                                            goon_hash_string(key));
+    if (entry) {
+        goon_event_t *queued = entry->event;
+        
+        if (ctx->coalesce_mode == GOON_COALESCE_MERGE && ctx->merge_func) {
+            merged = ctx->merge_func(queued, event, ctx->merge_user_data) == GOON_SUCCESS;
+        } else {
+            goon_event_set_data(queued, event->data);
+            event->data = NULL;
+            merged = true;
+        }
+    } else if (goon_coalesce_index_insert(ctx->coalesce_index, key, event) != GOON_SUCCESS) {
+        GOON_WARN("Failed to index event '%s', queueing it uncoalesced", key);
+    } else if (push) {
+        // A full queue leaves the event to the overflow policy, uncoalesced
+        *queued = goon_queue_try_push(ctx->event_queue, event) == GOON_SUCCESS;
+        if (!*queued) {
+            goon_coalesce_index_remove(ctx->coalesce_index, event);
+        }
+    }
+    
+    pthread_mutex_unlock(&ctx->coalesce_lock);
+    
+    if (!merged) return GOON_ERROR_NOT_FOUND;
+    
+    goon_event_destroy(event);
+    atomic_fetch_add_explicit(&ctx->coalesced_count, 1, memory_order_relaxed);
+    return GOON_SUCCESS;
+}
+
+static int goon_context_wait_for_space(goon_context_t *ctx, goon_event_t *event, long timeout_ms) {
+    struct timespec deadline;
+    if (timeout_ms >= 0) {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += timeout_ms / 1000;
+        deadline.tv_nsec += (timeout_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+    }
+    
+    atomic_fetch_add_explicit(&ctx->backpressure.blocked, 1, memory_order_relaxed);
+    
+    pthread_mutex_lock(&ctx->space_lock);
+    atomic_fetch_add(&ctx->space_waiters, 1);
+    
+    int result;
+    while ((result = goon_queue_try_push(ctx->event_queue, event)) == GOON_ERROR_OVERFLOW) {
+        if (timeout_ms < 0) {
+            pthread_cond_wait(&ctx->space_cond, &ctx->space_lock);
+        } else if (pthread_cond_timedwait(&ctx->space_cond, &ctx->space_lock, &deadline) == ETIMEDOUT) {
+            result = goon_queue_try_push(ctx->event_queue, event);
+            break;
+        }
+    }
+    
+    atomic_fetch_sub(&ctx->space_waiters, 1);
+    pthread_mutex_unlock(&ctx->space_lock);
+    
+    if (result == GOON_ERROR_OVERFLOW) {
+        atomic_fetch_add_explicit(&ctx->backpressure.timed_out, 1, memory_order_relaxed);
+        return GOON_ERROR_TIMEOUT;
+    }
+    
+    return result;
+}
+
+static int goon_context_handle_overflow(goon_context_t *ctx, goon_event_t *event,
+                                        goon_overflow_policy_t policy, long timeout_ms) {
+    switch (policy) {
+        case GOON_OVERFLOW_BLOCK:
+            return goon_context_wait_for_space(ctx, event, timeout_ms);
+            
+        case GOON_OVERFLOW_SPILL:
+            goon_context_spill(ctx, event);
+            return GOON_SUCCESS;
+            
+        case GOON_OVERFLOW_DROP_OLDEST:
+        case GOON_OVERFLOW_DROP_LOWEST:
+            // Bounded retries: other producers may take the freed slot first
+            for (int attempt = 0; attempt < 4; attempt++) {
+                goon_event_t *victim = goon_queue_evict(ctx->event_queue, policy, event->priority);
+                if (!victim) break;
+                
+                goon_context_unindex(ctx, &victim, 1);
+                goon_event_destroy(victim);
+                atomic_fetch_add_explicit(policy == GOON_OVERFLOW_DROP_OLDEST
+                                              ? &ctx->backpressure.dropped_oldest
+                                              : &ctx->backpressure.dropped_lowest,
+                                          1, memory_order_relaxed);
+                
+                if (goon_queue_try_push(ctx->event_queue, event) == GOON_SUCCESS) {
+                    return GOON_SUCCESS;
+                }
+            }
+            break;
+            
+        case GOON_OVERFLOW_REJECT:
+        default:
+            break;
+    }
+    
+    atomic_fetch_add_explicit(&ctx->backpressure.rejected, 1, memory_order_relaxed);
+    
+    // Warn once per overflow episode instead of once per rejected event
+    if (!atomic_exchange(&ctx->overflow_warned, true)) {
+        GOON_WARN("Context '%s' queue is full, rejecting events (%llu rejected so far)",
+                  ctx->name,
+                  (unsigned long long)atomic_load(&ctx->backpressure.rejected));
+    }
+    
+    return GOON_ERROR_OVERFLOW;
+}
+
+/*
+ * Wake a consumer blocked on the context's eventfd. Only the first call
+ * after the consumer last went idle pays for the write; the rest see
+ * wake_pending and return after a fence.
+ */
+void goon_context_notify(goon_context_t *ctx) {
+    if (!ctx || ctx->wake_fd < 0) return;
+    
+    // Pairs with the fence in goon_worker_wait: either it sees our work or we see it idle
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&ctx->wake_pending, memory_order_relaxed)) return;
+    if (atomic_exchange(&ctx->wake_pending, true)) return;
+    
+    uint64_t one = 1;
+    if (write(ctx->wake_fd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+        GOON_WARN("Failed to signal context '%s': %s", ctx->name, strerror(errno));
+    }
+}
+
+// For callers running their own poll loop; readable whenever goon_context_notify fired
+int goon_context_get_wake_fd(goon_context_t *ctx) {
+    return ctx ? ctx->wake_fd : -1;
+}
+
+/*
+ * Emit with an explicit overflow policy. On GOON_ERROR_OVERFLOW or
+ * GOON_ERROR_TIMEOUT the caller still owns the event. timeout_ms only
+ * applies to GOON_OVERFLOW_BLOCK; a negative value waits indefinitely.
+ */
+static int goon_context_emit_internal(goon_context_t *ctx, goon_event_t *event,
+                                      goon_overflow_policy_t policy, long timeout_ms,
+                                      const char *key) {
+    // Once merged, pushed or spilled the event belongs to someone else (a
+    // worker may already have freed it), so keep what the debug log needs
+    goon_symbol_t sym = event->sym;
+    uint32_t id = event->id;
+    
+    // Once anything has spilled, new events queue behind it to keep order;
+    // persistent contexts journal everything before it can be dispatched
+    bool spill = ctx->persistent ||
+                 (atomic_load_explicit(&ctx->spill_count, memory_order_acquire) > 0 &&
+                  policy == GOON_OVERFLOW_SPILL);
+    
+    bool queued = false;
+    if (ctx->coalesce_mode != GOON_COALESCE_OFF) {
+        if (goon_context_coalesce(ctx, event, key ? key : goon_event_get_name(event),
+                                  !spill, &queued) == GOON_SUCCESS) {
+            return GOON_SUCCESS;
+        }
+    }
+    
+    int result;
+    if (queued) {
+        result = GOON_SUCCESS;
+    } else if (spill) {
+        goon_context_spill(ctx, event);
+        result = GOON_SUCCESS;
+    } else {
+        result = goon_queue_try_push(ctx->event_queue, event);
+        if (result == GOON_ERROR_OVERFLOW) {
+            result = goon_context_handle_overflow(ctx, event, policy, timeout_ms);
+        }
+    }
+    
+    if (result == GOON_SUCCESS) {
+        ctx->event_count++;
+        goon_context_notify(ctx);
+        if (atomic_load_explicit(&ctx->overflow_warned, memory_order_relaxed)) {
+            atomic_store_explicit(&ctx->overflow_warned, false, memory_order_relaxed);
+        }
+        if (ctx->debug_mode) {
+            GOON_DEBUG("Event '%s' (ID: %u) emitted", goon_symbol_name(sym), id);
+        }
+    }
+    
+    return result;
+}
+
+int goon_context_emit_event_ex(goon_context_t *ctx, goon_event_t *event,
+                               goon_overflow_policy_t policy, long timeout_ms) {
+    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+    return goon_context_emit_internal(ctx, event, policy, timeout_ms, NULL);
+}
+
+/*
+ * Emit under a caller-chosen coalescing key instead of the event name.
+ * Behaves like goon_context_emit_event when coalescing is off. Keys must
+ * be shorter than GOON_MAX_NAME_LEN.
+ */
+int goon_context_emit_keyed(goon_context_t *ctx, goon_event_t *event, const char *key) {
+    if (!ctx || !event || !key) return GOON_ERROR_NULL_PTR;
+    if (strlen(key) >= GOON_MAX_NAME_LEN) return GOON_ERROR_INVALID_PARAM;
+    return goon_context_emit_internal(ctx, event, ctx->overflow_policy,
+                                      ctx->overflow_timeout_ms, key);
+}
+
+int goon_context_set_coalescing(goon_context_t *ctx, goon_coalesce_mode_t mode,
+                                goon_merge_func merge, void *user_data) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    if (mode == GOON_COALESCE_MERGE && !merge) return GOON_ERROR_INVALID_PARAM;
+    
+    pthread_mutex_lock(&ctx->coalesce_lock);
+    ctx->coalesce_mode = mode;
+    ctx->merge_func = merge;
+    ctx->merge_user_data = user_data;
+    pthread_mutex_unlock(&ctx->coalesce_lock);
+    
+    GOON_INFO("Context '%s' coalescing mode set to %d", ctx->name, mode);
+    return GOON_SUCCESS;
+}
+
+int goon_context_emit_event(goon_context_t *ctx, goon_event_t *event) {
+    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+    return goon_context_emit_event_ex(ctx, event, ctx->overflow_policy, ctx->overflow_timeout_ms);
+}
+
+int goon_context_set_overflow_policy(goon_context_t *ctx, goon_overflow_policy_t policy,
+                                     long timeout_ms) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    
+    ctx->overflow_policy = policy;
+    ctx->overflow_timeout_ms = timeout_ms;
+    return GOON_SUCCESS;
+}
+
+int goon_context_get_backpressure_stats(goon_context_t *ctx, goon_backpressure_stats_t *stats) {
+    if (!ctx || !stats) return GOON_ERROR_NULL_PTR;
+    
+    stats->rejected = atomic_load(&ctx->backpressure.rejected);
+    stats->blocked = atomic_load(&ctx->backpressure.blocked);
+    stats->timed_out = atomic_load(&ctx->backpressure.timed_out);
+    stats->dropped_oldest = atomic_load(&ctx->backpressure.dropped_oldest);
+    stats->dropped_lowest = atomic_load(&ctx->backpressure.dropped_lowest);
+    stats->spilled = atomic_load(&ctx->backpressure.spilled);
+    stats->unspilled = atomic_load(&ctx->backpressure.unspilled);
+    stats->spill_high_water = atomic_load(&ctx->backpressure.spill_high_water);
+    return GOON_SUCCESS;
+}
+
+/*
+ * Opt into carving events and copied payloads created during this
+ * context's ticks from a per-tick arena. Anything that must outlive the
+ * tick it was created in has to go through goon_event_promote() or
+ * goon_data_promote(); until then it only holds its arena generation back.
+ */
+int goon_context_set_arena_mode(goon_context_t *ctx, bool enabled) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    
+    pthread_mutex_lock(&ctx->arena_lock);
+    ctx->arena_mode = enabled;
+    pthread_mutex_unlock(&ctx->arena_lock);
+    return GOON_SUCCESS;
+}
+
+int goon_context_get_arena_stats(goon_context_t *ctx, goon_arena_stats_t *stats) {
+    if (!ctx || !stats) return GOON_ERROR_NULL_PTR;
+    
+    memset(stats, 0, sizeof(*stats));
+    pthread_mutex_lock(&ctx->arena_lock);
+    stats->enabled = ctx->arena_mode;
+    for (int i = 0; i < 2; i++) {
+        stats->blocks += ctx->arenas[i].block_count;
+        stats->live += atomic_load(&ctx->arenas[i].live);
+        stats->allocs += ctx->arenas[i].allocs;
+        stats->resets += ctx->arenas[i].resets;
+    }
+    stats->bytes = stats->blocks * GOON_ARENA_BLOCK_SIZE;
+    pthread_mutex_unlock(&ctx->arena_lock);
+    return GOON_SUCCESS;
+}
+
+int goon_context_get_slab_stats(goon_context_t *ctx, goon_slab_stats_t *stats) {
+    if (!ctx || !stats) return GOON_ERROR_NULL_PTR;
+    return goon_event_slab_get_stats(ctx->event_slab, stats);
+}
+
+// Blocked workers recompute their timeout, since the new timer may be the earliest
+// Arena events are promoted first, since the timer holds them past the tick
+goon_timer_id_t goon_context_emit_at(goon_context_t *ctx, goon_event_t *event, uint64_t when_ms) {
+    if (!ctx || !event) return 0;
+    
+    goon_event_t *held = event->in_arena ? goon_event_promote_copy(event) : event;
+    if (!held) return 0;
+    
+    goon_timer_id_t id = goon_timer_wheel_schedule(ctx->timers, held, when_ms, 0);
+    if (held != event) goon_event_promote_finish(event, held, id != 0);
+    if (id) goon_context_notify(ctx);
+    return id;
+}
+
+goon_timer_id_t goon_context_emit_after(goon_context_t *ctx, goon_event_t *event, uint64_t delay_ms) {
+    if (!ctx || !event) return 0;
+    return goon_context_emit_at(ctx, event, goon_time_now_ms() + delay_ms);
+}
+
+/*
+ * Emit a copy of `event` every interval_ms until cancelled. The context
+ * keeps `event` as the template and frees it on cancel.
+ */
+goon_timer_id_t goon_context_emit_every(goon_context_t *ctx, goon_event_t *event, uint64_t interval_ms) {
+    if (!ctx || !event || interval_ms == 0) return 0;
+    
+    goon_event_t *held = event->in_arena ? goon_event_promote_copy(event) : event;
+    if (!held) return 0;
+    
+    goon_timer_id_t id = goon_timer_wheel_schedule(ctx->timers, held, goon_time_now_ms() + interval_ms, interval_ms);
+    if (held != event) goon_event_promote_finish(event, held, id != 0);
+    if (id) goon_context_notify(ctx);
+    return id;
+}
+
+int goon_context_cancel_timer(goon_context_t *ctx, goon_timer_id_t id) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    return goon_timer_wheel_cancel(ctx->timers, id);
+}
+
+int goon_context_advance_timers(goon_context_t *ctx) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    
+    goon_event_t *event = NULL;
+    size_t due = goon_timer_wheel_advance(ctx->timers, goon_time_now_ms(), &event);
+    if (due == 0) return 0;
+    
+    int emitted = 0;
+    while (event) {
+        goon_event_t *next = event->next;
+        
+        // Never block the timer thread; a full queue retries on the next tick
+        goon_overflow_policy_t policy = ctx->overflow_policy == GOON_OVERFLOW_BLOCK
+                                            ? GOON_OVERFLOW_REJECT
+                                            : ctx->overflow_policy;
+        if (goon_context_emit_event_ex(ctx, event, policy, 0) == GOON_SUCCESS) {
+            emitted++;
+        } else if (!goon_context_emit_after(ctx, event, 1)) {
+            goon_event_destroy(event);
+        }
+        
+        event = next;
+    }
+    
+    return emitted;
+}
+
+/*
+ * A batch is dispatched as a plan of steps, one per subscribed handler,
+ * each with the mask of batch events it receives. Steps run in handler
+ * order unless declared dependencies require otherwise. With fan-out
+ * enabled on a pooled context, steps that neither depend on each other
+ * nor mutate shared events run in parallel on the worker threads.
+ */
+typedef struct {
+    const goon_dispatch_entry_t *entry;
+    uint64_t mask;
+    uint32_t *succ;
+    uint32_t succ_count;
+    _Atomic uint32_t pending;
+} goon_dispatch_step_t;
+
+typedef struct goon_dispatch_plan {
+    goon_context_t *ctx;
+    goon_event_t **events;
+    goon_dispatch_step_t *steps;
+    size_t step_count;
+    uint32_t *ready;
+    size_t ready_count;
+    pthread_mutex_t ready_lock;
+    _Atomic size_t remaining;
+    _Atomic uint32_t refs;
+    _Atomic uint64_t dropped;
+    _Atomic uint64_t suspended;
+    _Atomic uint64_t stopped[GOON_DISPATCH_BATCH];
+    goon_async_t *tokens[GOON_DISPATCH_BATCH];
+} goon_dispatch_plan_t;
+
+// The handler call in progress on this thread, for goon_async_suspend()
+typedef struct goon_dispatch_frame {
+    goon_dispatch_plan_t *plan;
+    goon_handler_t *handler;
+    int index;
+    goon_async_t *token;
+} goon_dispatch_frame_t;
+
+static __thread goon_dispatch_frame_t *g_dispatch_frame = NULL;
+
+static bool goon_worker_fanout(goon_context_t *ctx, goon_event_t **events,
+                               goon_dispatch_step_t *steps, size_t step_count);
+
+static void goon_dispatch_run_step(goon_dispatch_plan_t *plan, goon_dispatch_step_t *step) {
+    goon_context_t *ctx = plan->ctx;
+    const goon_dispatch_entry_t *entry = step->entry;
+    goon_handler_t *handler = entry->handler;
+    if (!handler->enabled) return;
+    
+    uint64_t chain_bit = 1ULL << handler->chain;
+    size_t delivered = 0;
+    
+    // Off costs one branch per step; sampling keeps a per-thread countdown
+    bool timing = GOON_TIMING_COMPILED && ctx->timing_mode != GOON_TIMING_OFF;
+    static __thread uint32_t sample_countdown = 0;
+    
+    for (uint64_t mask = step->mask; mask; mask &= mask - 1) {
+        int i = __builtin_ctzll(mask);
+        
+        if (((atomic_load_explicit(&plan->dropped, memory_order_acquire) |
+              atomic_load_explicit(&plan->suspended, memory_order_acquire)) >> i & 1) ||
+            (atomic_load_explicit(&plan->stopped[i], memory_order_acquire) & chain_bit)) {
+            continue;
+        }
+        
+        goon_dispatch_frame_t frame = { plan, handler, i, NULL };
+        goon_dispatch_frame_t *outer = g_dispatch_frame;
+        g_dispatch_frame = &frame;
+        
+        int result;
+        if (timing && sample_countdown-- == 0) {
+            sample_countdown = ctx->timing_sample_rate - 1;
+            
+            uint64_t start = goon_cycles();
+            result = entry->func(ctx, plan->events[i], entry->user_data);
+            uint64_t elapsed = goon_cycles_to_ns(goon_cycles() - start);
+            
+            goon_histogram_t *hist = goon_handler_latency(handler);
+            if (hist) goon_histogram_record(hist, elapsed);
+        } else {
+            result = entry->func(ctx, plan->events[i], entry->user_data);
+        }
+        
+        g_dispatch_frame = outer;
+        
+        if (frame.token) {
+            // The token owns the event now; later handlers run on resume
+            if (result != GOON_PENDING) {
+                GOON_WARN("Handler '%s' suspended event %u but returned %d", handler->name,
+                          plan->events[i]->id, result);
+            }
+        } else if (result == GOON_PENDING) {
+            atomic_fetch_add_explicit(&handler->error_count, 1, memory_order_relaxed);
+            GOON_WARN("Handler '%s' returned GOON_PENDING without suspending", handler->name);
+        } else if ((result == GOON_DROP || result == GOON_STOP_CHAIN) && !handler->mutates) {
+            // Honouring it would depend on whether later steps ran in parallel
+            atomic_fetch_add_explicit(&handler->error_count, 1, memory_order_relaxed);
+            GOON_WARN("Read-only handler '%s' returned verdict %d, ignoring it", handler->name, result);
+        } else if (result == GOON_DROP) {
+            atomic_fetch_or_explicit(&plan->dropped, 1ULL << i, memory_order_release);
+            atomic_fetch_add_explicit(&handler->drop_count, 1, memory_order_relaxed);
+        } else if (result == GOON_STOP_CHAIN) {
+            atomic_fetch_or_explicit(&plan->stopped[i], chain_bit, memory_order_release);
+            atomic_fetch_add_explicit(&handler->drop_count, 1, memory_order_relaxed);
+        } else if (result != GOON_SUCCESS) {
+            atomic_fetch_add_explicit(&handler->error_count, 1, memory_order_relaxed);
+            GOON_WARN("Handler '%s' returned error %d", handler->name, result);
+        }
+        delivered++;
+    }
+    
+    if (delivered == 0) return;
+    
+    atomic_fetch_add_explicit(&handler->call_count, delivered, memory_order_relaxed);
+    
+    if (ctx->debug_mode) {
+        GOON_DEBUG("Handler '%s' executed %zu events", handler->name, delivered);
+    }
+}
+
+static void goon_dispatch_sort_dependencies(goon_dispatch_step_t *steps, size_t count) {
+    // Stable topological order: take the earliest step whose declared
+    // dependencies are already placed. Cycles fall back to handler order.
+    for (size_t pos = 0; pos < count; pos++) {
+        size_t pick = pos;
+        
+        for (size_t i = pos; i < count; i++) {
+            bool blocked = false;
+            for (size_t j = pos; j < count && !blocked; j++) {
+                blocked = j != i && goon_handler_depends(steps[i].entry->handler, steps[j].entry->handler);
+            }
+            if (!blocked) {
+                pick = i;
+                break;
+            }
+        }
+        
+        if (pick != pos) {
+            goon_dispatch_step_t step = steps[pick];
+            memmove(&steps[pos + 1], &steps[pos], (pick - pos) * sizeof(goon_dispatch_step_t));
+            steps[pos] = step;
+        }
+    }
+}
+
+static bool goon_handler_runs_after(const goon_handler_t *handler, const goon_async_t *token) {
+    if (handler->order != token->order) return handler->order > token->order;
+    return handler->route_rank < token->route_rank;
+}
+
+// Hand suspended events to their tokens once no step of the plan can touch them
+static void goon_dispatch_settle(goon_dispatch_plan_t *plan);
+
+/*
+ * Dispatch `events` to their subscribed handlers. With `from` set, the
+ * single event is being resumed and only handlers that run after the
+ * suspended one see it. Suspended events are replaced by NULL in
+ * `events`; the caller destroys the rest.
+ */
+static void goon_context_dispatch_from(goon_context_t *ctx, goon_event_t **events, size_t count,
+                                       const goon_async_t *from) {
+    const goon_route_t *routes[GOON_DISPATCH_BATCH];
+    size_t cursor[GOON_DISPATCH_BATCH];
+    goon_dispatch_step_t local_steps[GOON_DISPATCH_BATCH];
+    goon_dispatch_step_t *steps = local_steps;
+    size_t step_capacity = GOON_DISPATCH_BATCH;
+    size_t step_count = 0;
+    bool has_dependencies = false;
+    
+    while (count > GOON_DISPATCH_BATCH) {
+        goon_context_dispatch_from(ctx, events, GOON_DISPATCH_BATCH, NULL);
+        events += GOON_DISPATCH_BATCH;
+        count -= GOON_DISPATCH_BATCH;
+    }
+    
+    // The table and every handler it names stay valid until the read
+    // section ends, even if handlers are added or removed meanwhile
+    goon_rcu_read_lock();
+    
+    goon_dispatch_table_t *table;
+    size_t resolved;
+    do {
+        table = atomic_load(&ctx->router->table);
+        for (resolved = 0; resolved < count; resolved++) {
+            routes[resolved] = goon_router_resolve(ctx->router, table, events[resolved]->sym);
+            if (!routes[resolved]) break;
+            cursor[resolved] = 0;
+        }
+    } while (resolved < count);
+    
+    // Handler-major order: each subscribed handler runs over its events in the
+    // batch, so its code and state stay hot and timing is paid once per batch.
+    // Table slots are in run order, so merging the routes' heads visits each
+    // handler once, and verdicts from earlier handlers are seen by later ones.
+    for (;;) {
+        uint32_t slot = GOON_ROUTE_SLOT_NONE;
+        for (size_t i = 0; i < count; i++) {
+            if (cursor[i] < routes[i]->count && routes[i]->slots[cursor[i]] < slot) {
+                slot = routes[i]->slots[cursor[i]];
+            }
+        }
+        
+        if (slot == GOON_ROUTE_SLOT_NONE) break;
+        
+        uint64_t mask = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (cursor[i] < routes[i]->count && routes[i]->slots[cursor[i]] == slot) {
+                cursor[i]++;
+                mask |= 1ULL << i;
+            }
+        }
+        
+        const goon_dispatch_entry_t *entry = &table->entries[slot];
+        if (from && !goon_handler_runs_after(entry->handler, from)) continue;
+        
+        if (step_count == step_capacity) {
+            size_t capacity = step_capacity * 2;
+            goon_dispatch_step_t *grown = (goon_dispatch_step_t*)malloc(capacity * sizeof(goon_dispatch_step_t));
+            if (!grown) {
+                GOON_ERROR_LOG("Failed to grow dispatch plan, skipping handler '%s'", entry->handler->name);
+                continue;
+            }
+            memcpy(grown, steps, step_count * sizeof(goon_dispatch_step_t));
+            if (steps != local_steps) free(steps);
+            steps = grown;
+            step_capacity = capacity;
+        }
+        
+        steps[step_count].entry = entry;
+        steps[step_count].mask = mask;
+        steps[step_count].succ = NULL;
+        steps[step_count].succ_count = 0;
+        atomic_init(&steps[step_count].pending, 0);
+        step_count++;
+        
+        has_dependencies |= entry->handler->after_count > 0;
+    }
+    
+    if (has_dependencies) {
+        goon_dispatch_sort_dependencies(steps, step_count);
+    }
+    
+    if (from || !ctx->fanout || step_count < 2 || !goon_worker_fanout(ctx, events, steps, step_count)) {
+        goon_dispatch_plan_t plan;
+        plan.ctx = ctx;
+        plan.events = events;
+        plan.step_count = step_count;
+        atomic_init(&plan.dropped, 0);
+        atomic_init(&plan.suspended, 0);
+        for (size_t i = 0; i < count; i++) {
+            atomic_init(&plan.stopped[i], from ? from->stopped : 0);
+        }
+        
+        for (size_t i = 0; i < step_count; i++) {
+            goon_dispatch_run_step(&plan, &steps[i]);
+        }
+        goon_dispatch_settle(&plan);
+    }
+    
+    if (steps != local_steps) free(steps);
+    
+    goon_rcu_read_unlock();
+}
+
+static void goon_context_dispatch_batch(goon_context_t *ctx, goon_event_t **events, size_t count) {
+    goon_context_dispatch_from(ctx, events, count, NULL);
+}
+
+/*
+ * A handler that cannot finish synchronously calls goon_async_suspend()
+ * and returns GOON_PENDING. The event leaves its batch and later handlers
+ * skip it; the rest of the batch keeps flowing. When the I/O completes,
+ * any thread calls goon_async_resume(). A dispatching thread then runs
+ * `resume(ctx, event, state)`, whose verdict stands in for the handler's,
+ * and continues the event through the handlers after it. A resume
+ * callback may return GOON_PENDING again to wait for another
+ * goon_async_resume() on the same token. Without a callback the event
+ * simply continues.
+ */
+
+static void goon_async_enqueue(goon_async_t *token) {
+    goon_context_t *ctx = token->ctx;
+    token->next = NULL;
+    
+    pthread_mutex_lock(&ctx->async_lock);
+    if (ctx->async_tail) {
+        ctx->async_tail->next = token;
+    } else {
+        ctx->async_head = token;
+    }
+    ctx->async_tail = token;
+    atomic_fetch_add_explicit(&ctx->async_ready, 1, memory_order_release);
+    pthread_mutex_unlock(&ctx->async_lock);
+    
+    goon_context_notify(ctx);
+}
+
+static void goon_async_park(goon_async_t *token) {
+    int status = GOON_ASYNC_RUNNING;
+    if (!atomic_compare_exchange_strong(&token->status, &status, GOON_ASYNC_WAITING)) {
+        // Resumed before the handler even returned
+        atomic_store(&token->status, GOON_ASYNC_QUEUED);
+        goon_async_enqueue(token);
+    }
+}
+
+static void goon_dispatch_settle(goon_dispatch_plan_t *plan) {
+    uint64_t suspended = atomic_load_explicit(&plan->suspended, memory_order_acquire);
+    for (; suspended; suspended &= suspended - 1) {
+        int i = __builtin_ctzll(suspended);
+        plan->events[i] = NULL;
+        goon_async_park(plan->tokens[i]);
+    }
+}
+
+// Call from inside a handler for the event it was given, then return GOON_PENDING
+goon_async_t* goon_async_suspend(goon_context_t *ctx, goon_event_t *event, goon_handler_func resume, void *state) {
+    goon_dispatch_frame_t *frame = g_dispatch_frame;
+    if (!ctx || !event || !frame || frame->plan->ctx != ctx || frame->plan->events[frame->index] != event) {
+        GOON_ERROR_LOG("goon_async_suspend called outside the handler dispatching this event");
+        return NULL;
+    }
+    
+    if (frame->token) return frame->token;
+    
+    if (!frame->handler->mutates) {
+        GOON_ERROR_LOG("Read-only handler '%s' cannot suspend events", frame->handler->name);
+        return NULL;
+    }
+    
+    goon_dispatch_plan_t *plan = frame->plan;
+    uint64_t bit = 1ULL << frame->index;
+    if (atomic_fetch_or(&plan->suspended, bit) & bit) {
+        GOON_WARN("Event %u is already suspended by another handler", event->id);
+        return NULL;
+    }
+    
+    goon_async_t *token = (goon_async_t*)malloc(sizeof(goon_async_t));
+    if (!token) {
+        atomic_fetch_and(&plan->suspended, ~bit);
+        GOON_ERROR_LOG("Failed to allocate memory for goon_async_t");
+        return NULL;
+    }
+    
+    goon_handler_t *handler = frame->handler;
+    token->ctx = ctx;
+    token->event = event;
+    token->resume = resume;
+    token->state = state;
+    token->handler_sym = handler->name_sym;
+    token->order = handler->order;
+    token->route_rank = handler->route_rank;
+    token->chain = handler->chain;
+    token->stopped = atomic_load(&plan->stopped[frame->index]);
+    atomic_init(&token->status, GOON_ASYNC_RUNNING);
+    token->next = NULL;
+    
+    plan->tokens[frame->index] = token;
+    frame->token = token;
+    atomic_fetch_add(&ctx->async_suspended, 1);
+    return token;
+}
+
+// Safe from any thread, including before the suspending handler has returned
+int goon_async_resume(goon_async_t *token) {
+    if (!token) return GOON_ERROR_NULL_PTR;
+    
+    int status = atomic_load(&token->status);
+    for (;;) {
+        if (status == GOON_ASYNC_WAITING) {
+            if (atomic_compare_exchange_weak(&token->status, &status, GOON_ASYNC_QUEUED)) {
+                goon_async_enqueue(token);
+                return GOON_SUCCESS;
+            }
+        } else if (status == GOON_ASYNC_RUNNING) {
+            // Once this lands the token may be requeued and freed: do not touch it again
+            if (atomic_compare_exchange_weak(&token->status, &status, GOON_ASYNC_RESUMED)) {
+                return GOON_SUCCESS;
+            }
+        } else {
+            return GOON_SUCCESS;
+        }
+    }
+}
+
+goon_event_t* goon_async_event(const goon_async_t *token) {
+    return token ? token->event : NULL;
+}
+
+size_t goon_context_suspended_count(goon_context_t *ctx) {
+    return ctx ? atomic_load(&ctx->async_suspended) : 0;
+}
+
+static void goon_async_continue(goon_context_t *ctx, goon_async_t *token) {
+    goon_event_t *event = token->event;
+    int verdict = token->resume ? token->resume(ctx, event, token->state) : GOON_CONTINUE;
+    
+    if (verdict == GOON_PENDING) {
+        goon_async_park(token);
+        return;
+    }
+    
+    atomic_fetch_sub(&ctx->async_suspended, 1);
+    
+    if (verdict == GOON_STOP_CHAIN) {
+        token->stopped |= 1ULL << token->chain;
+    } else if (verdict != GOON_SUCCESS && verdict != GOON_DROP) {
+        GOON_WARN("Handler '%s' resumed with error %d", goon_symbol_name(token->handler_sym), verdict);
+    }
+    
+    if (verdict != GOON_DROP) {
+        goon_context_dispatch_from(ctx, &event, 1, token);
+    }
+    
+    goon_event_destroy(event);
+    free(token);
+}
+
+// Run continuations resumed so far; returns how many ran
+static size_t goon_context_run_continuations(goon_context_t *ctx) {
+    if (atomic_load_explicit(&ctx->async_ready, memory_order_acquire) == 0) return 0;
+    
+    pthread_mutex_lock(&ctx->async_lock);
+    goon_async_t *token = ctx->async_head;
+    ctx->async_head = NULL;
+    ctx->async_tail = NULL;
+    atomic_store_explicit(&ctx->async_ready, 0, memory_order_relaxed);
+    pthread_mutex_unlock(&ctx->async_lock);
+    
+    size_t count = 0;
+    while (token) {
+        goon_async_t *next = token->next;
+        atomic_store(&token->status, GOON_ASYNC_RUNNING);
+        goon_async_continue(ctx, token);
+        token = next;
+        count++;
+    }
+    
+    return count;
+}
+
+/*
+ * GOON_TIMING_SAMPLED times one handler call in `sample_rate` per thread
+ * (1 times every call). GOON_TIMING_OFF skips the cycle counter entirely.
+ */
+int goon_context_set_timing(goon_context_t *ctx, goon_timing_mode_t mode, uint32_t sample_rate) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    if (mode == GOON_TIMING_SAMPLED && sample_rate == 0) return GOON_ERROR_INVALID_PARAM;
+    
+    if (!GOON_TIMING_COMPILED && mode != GOON_TIMING_OFF) {
+        GOON_WARN("Handler timing is compiled out (GOON_DISABLE_TIMING)");
+        return GOON_ERROR;
+    }
+    
+    ctx->timing_mode = mode;
+    if (mode == GOON_TIMING_SAMPLED) {
+        ctx->timing_sample_rate = sample_rate;
+    }
+    
+    return GOON_SUCCESS;
+}
+
+int goon_context_set_fanout(goon_context_t *ctx, bool enabled) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    
+    ctx->fanout = enabled;
+    GOON_INFO("Context '%s' handler fan-out %s", ctx->name, enabled ? "enabled" : "disabled");
+    return GOON_SUCCESS;
+}
+
+// Caller holds arena_lock. Rewind the active generation if the tick left
+// nothing alive in it, else switch to the other one once it has drained.
+static void goon_context_arena_recycle(goon_context_t *ctx) {
+    goon_arena_t *active = &ctx->arenas[ctx->arena_active];
+    goon_arena_t *other = &ctx->arenas[ctx->arena_active ^ 1];
+    
+    if (atomic_load_explicit(&active->live, memory_order_acquire) == 0) {
+        if (active->current) goon_arena_reset(active);
+    } else if (atomic_load_explicit(&other->live, memory_order_acquire) == 0) {
+        if (other->current) goon_arena_reset(other);
+        ctx->arena_active ^= 1;
+    }
+}
+
+int goon_context_process_events(goon_context_t *ctx) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    
+    if (ctx->state != GOON_STATE_RUNNING) {
+        GOON_WARN("Context is not in RUNNING state");
+        return GOON_ERROR;
+    }
+    
+    int processed = 0;
+    goon_event_t *batch[GOON_DISPATCH_BATCH];
+    
+    // Only one thread at a time ticks with the arena; others use the heap
+    goon_arena_t *outer_arena = g_tick_arena;
+    bool arena_held = ctx->arena_mode && pthread_mutex_trylock(&ctx->arena_lock) == 0;
+    if (arena_held) {
+        g_tick_arena = &ctx->arenas[ctx->arena_active];
+    }
+    
+    // Recovered or journaled events only reach the queue through unspill
+    if (atomic_load_explicit(&ctx->spill_count, memory_order_acquire) > 0) {
+        goon_context_unspill(ctx);
+    }
+    
+    goon_context_run_continuations(ctx);
+    
+    while (!goon_queue_is_empty(ctx->event_queue)) {
+        size_t count = goon_queue_pop_batch(ctx->event_queue, batch, GOON_DISPATCH_BATCH);
+        if (count == 0) break;
+        
+        goon_context_unindex(ctx, batch, count);
+        goon_context_release_space(ctx);
+        
+        if (ctx->debug_mode) {
+            GOON_DEBUG("Processing batch of %zu events (first ID: %u)", count, batch[0]->id);
+        }
+        
+        goon_context_dispatch_batch(ctx, batch, count);
+        
+        for (size_t i = 0; i < count; i++) {
+            goon_event_destroy(batch[i]);
+        }
+        
+        processed += (int)count;
+        ctx->total_events_processed += count;
+    }
+    
+    if (processed > 0) {
+        goon_context_commit_spill(ctx);
+    }
+    
+    if (arena_held) {
+        goon_context_arena_recycle(ctx);
+        g_tick_arena = outer_arena;
+        pthread_mutex_unlock(&ctx->arena_lock);
+    }
+    
+    return processed;
+}
+
+/* ============================================================================
+ * INITIALIZATION AND CLEANUP
+ * ============================================================================ */
+
+int goon_init(const char *context_name) {
+    if (g_goon_ctx) {
+        GOON_WARN("Goon module already initialized");
+        return GOON_ERROR;
+    }
+    
+    g_goon_ctx = goon_context_create(context_name);
+    if (!g_goon_ctx) {
+        GOON_ERROR_LOG("Failed to create goon context");
+        return GOON_ERROR;
+    }
+    
+    goon_context_set_state(g_goon_ctx, GOON_STATE_INITIALIZING);
+    GOON_INFO("Goon module initialized (version %s)", GOON_VERSION);
+    
+    return GOON_SUCCESS;
+}
+
+void goon_cleanup(void) {
+    if (!g_goon_ctx) return;
+    
+    GOON_INFO("Cleaning up goon module");
+    goon_context_destroy(g_goon_ctx);
+    g_goon_ctx = NULL;
+}
+
+goon_context_t* goon_get_context(void) {
+    return g_goon_ctx;
+}
+
+/* ============================================================================
+ * UTILITY FUNCTIONS
+ * ============================================================================ */
+
+void goon_print_stats(goon_context_t *ctx) {
+    if (!ctx) return;
+    
+    printf("\n=== Goon Context Statistics ===\n");
+    printf("Context Name: %s\n", ctx->name);
+    printf("Context ID: %u\n", ctx->id);
+    printf("State: %d\n", ctx->state);
+    printf("Handlers Registered: %zu\n", ctx->handler_count);
+    printf("Queue Mode: %d\n", ctx->queue_mode);
+    printf("Drain Policy: %d\n", ctx->drain_policy);
+    printf("Events in Queue: %zu\n", goon_queue_size(ctx->event_queue));
+    printf("Queue Memory: %zu bytes\n", goon_queue_memory_usage(ctx->event_queue));
+    printf("Pending Timers: %zu\n", goon_timer_wheel_pending(ctx->timers));
+    
+    goon_slab_stats_t slab;
+    if (goon_context_get_slab_stats(ctx, &slab) == GOON_SUCCESS) {
+        printf("Event Slab: %zu/%zu slots outstanding, %zu chunks, %zu bytes (%llu depot exchanges)\n",
+               slab.outstanding, slab.capacity, slab.chunks, slab.bytes,
+               (unsigned long long)slab.exchanges);
+    }
+    
+    goon_pool_stats_t pool;
+    if (goon_pool_get_stats(ctx->memory_pool, &pool) == GOON_SUCCESS) {
+        printf("Memory Pool: %zu objects in use, %zu bytes cached (%llu misses, %zu oversize)\n",
+               pool.total_in_use, pool.cached_bytes, (unsigned long long)pool.misses, pool.oversize);
+        printf("Pool Depot: %llu gets, %llu puts, %llu contended, %zu magazines\n",
+               (unsigned long long)pool.depot_gets, (unsigned long long)pool.depot_puts,
+               (unsigned long long)pool.contended, pool.magazines);
+    }
+    
+    goon_arena_stats_t arena;
+    if (goon_context_get_arena_stats(ctx, &arena) == GOON_SUCCESS && arena.enabled) {
+        printf("Tick Arena: %zu blocks, %zu bytes, %zu live (%llu allocs, %llu resets)\n",
+               arena.blocks, arena.bytes, arena.live, (unsigned long long)arena.allocs,
+               (unsigned long long)arena.resets);
+    }
+    printf("Total Events Processed: %llu\n", (unsigned long long)ctx->total_events_processed);
+    
+    goon_backpressure_stats_t bp;
+    goon_context_get_backpressure_stats(ctx, &bp);
+    printf("Coalescing Mode: %d (coalesced: %llu)\n", ctx->coalesce_mode,
+           (unsigned long long)atomic_load(&ctx->coalesced_count));
+    printf("Overflow Policy: %d\n", ctx->overflow_policy);
+    printf("Overflow - Rejected: %llu, Blocked: %llu, Timed Out: %llu\n",
+           (unsigned long long)bp.rejected, (unsigned long long)bp.blocked,
+           (unsigned long long)bp.timed_out);
+    printf("Overflow - Dropped Oldest: %llu, Dropped Lowest: %llu\n",
+           (unsigned long long)bp.dropped_oldest, (unsigned long long)bp.dropped_lowest);
+    printf("Overflow - Spilled: %llu, Unspilled: %llu, Spill Depth: %zu (max %llu)\n",
+           (unsigned long long)bp.spilled, (unsigned long long)bp.unspilled,
+           atomic_load(&ctx->spill_count), (unsigned long long)bp.spill_high_water);
+    if (ctx->disk_queue) {
+        printf("Disk queue: %s (%zu pending, %llu appended, %llu recycled)%s\n",
+               ctx->disk_queue->dir, goon_disk_queue_pending(ctx->disk_queue),
+               (unsigned long long)ctx->disk_queue->appended,
+               (unsigned long long)ctx->disk_queue->recycled,
+               ctx->persistent ? " [persistent]" : "");
+    }
+    pthread_mutex_lock(&ctx->router->lock);
+    goon_dispatch_table_t *table = atomic_load(&ctx->router->table);
+    printf("Routing: %zu exact, %zu prefix, %zu glob, %zu wildcard (table v%llu, routes: %zu, misses: %llu)\n",
+           ctx->router->subscriptions[GOON_MATCH_EXACT], ctx->router->subscriptions[GOON_MATCH_PREFIX],
+           ctx->router->subscriptions[GOON_MATCH_GLOB], ctx->router->subscriptions[GOON_MATCH_ALL],
+           (unsigned long long)(table ? table->version : 0), table ? atomic_load(&table->route_count) : 0,
+           (unsigned long long)ctx->router->route_misses);
+    pthread_mutex_unlock(&ctx->router->lock);
+    if (ctx->timing_mode == GOON_TIMING_SAMPLED) {
+        printf("Handler Timing: sampled 1/%u\n", ctx->timing_sample_rate);
+    } else {
+        printf("Handler Timing: off\n");
+    }
+    printf("Uptime: %ld seconds\n", time(NULL) - ctx->start_time);
+    printf("\n=== Handler Statistics ===\n");
+    
+    goon_handler_t *handler = ctx->handlers;
     while (handler) {
-        if (strcmp(handler->name, name) == 0) {
-            if (prev) {
-                prev->next = handler->next;
-            } else {
-                ctx->handlers = handler->next;
+        printf("\nHandler: %s (ID: %u)\n", handler->name, handler->id);
+        printf("  Enabled: %s\n", handler->enabled ? "Yes" : "No");
+        printf("  Subscription: %s\n", handler->pattern);
+        printf("  Chain: %s, Order: %d\n", goon_context_get_chain_name(ctx, handler->chain), handler->order);
+        printf("  Call Count: %llu\n", (unsigned long long)handler->call_count);
+        printf("  Error Count: %llu\n", (unsigned long long)handler->error_count);
+        printf("  Drop Count: %llu\n", (unsigned long long)handler->drop_count);
+        printf("  Avg Execution Time: %.3f ms\n", goon_handler_avg_exec_ms(handler));
+        
+        goon_histogram_t *hist = atomic_load(&handler->latency);
+        if (hist && atomic_load(&hist->total) > 0) {
+            printf("  Latency: p50 %llu ns, p99 %llu ns, p999 %llu ns, max %llu ns (%llu samples)\n",
+                   (unsigned long long)goon_histogram_percentile(hist, 50.0),
+                   (unsigned long long)goon_histogram_percentile(hist, 99.0),
+                   (unsigned long long)goon_histogram_percentile(hist, 99.9),
+                   (unsigned long long)atomic_load(&hist->max_ns),
+                   (unsigned long long)atomic_load(&hist->total));
+        }
+        handler = handler->next;
+    }
+    
+    printf("\n");
+}
+
+int goon_start(goon_context_t *ctx) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    
+    goon_context_set_state(ctx, GOON_STATE_RUNNING);
+    goon_context_notify(ctx);
+    GOON_INFO("Goon context '%s' started", ctx->name);
+    return GOON_SUCCESS;
+}
+
+int goon_stop(goon_context_t *ctx) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    
+    goon_context_set_state(ctx, GOON_STATE_STOPPING);
+    GOON_INFO("Goon context '%s' stopping", ctx->name);
+    
+    // Process remaining events
+    goon_context_process_events(ctx);
+    
+    goon_context_set_state(ctx, GOON_STATE_TERMINATED);
+    return GOON_SUCCESS;
+}
+
+int goon_pause(goon_context_t *ctx) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    
+    goon_context_set_state(ctx, GOON_STATE_PAUSED);
+    GOON_INFO("Goon context '%s' paused", ctx->name);
+    return GOON_SUCCESS;
+}
+
+int goon_resume(goon_context_t *ctx) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    
+    goon_context_set_state(ctx, GOON_STATE_RUNNING);
+    goon_context_notify(ctx);
+    GOON_INFO("Goon context '%s' resumed", ctx->name);
+    return GOON_SUCCESS;
+}
+
+/* ============================================================================
+ * EXAMPLE HANDLER FUNCTIONS
+ * ============================================================================ */
+
+int goon_handler_echo(goon_context_t *ctx, goon_event_t *event, void *user_data) {
+    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+    
+    printf("[ECHO HANDLER] Event: %s (ID: %u, Priority: %d)\n", 
+           goon_event_get_name(event), event->id, goon_event_get_priority(event));
+    
+    if (event->data) {
+        goon_data_t *data = event->data;
+        printf("[ECHO HANDLER] Data type: %d, size: %zu\n", data->type, data->size);
+        
+        if (data->type == GOON_TYPE_STRING && data->value) {
+            printf("[ECHO HANDLER] String value: %s\n", (char*)data->value);
+        } else if (data->type == GOON_TYPE_INT && data->value) {
+            printf("[ECHO HANDLER] Int value: %d\n", *(int*)data->value);
+        } else if (data->type == GOON_TYPE_FLOAT && data->value) {
+            printf("[ECHO HANDLER] Float value: %f\n", *(float*)data->value);
+        }
+    }
+    
+    return GOON_SUCCESS;
+}
+
+int goon_handler_logger(goon_context_t *ctx, goon_event_t *event, void *user_data) {
+    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+    
+    FILE *log_file = (FILE*)user_data;
+    if (!log_file) {
+        log_file = stdout;
+    }
+    
+    time_t timestamp = goon_event_get_timestamp(event);
+    fprintf(log_file, "[LOG] %s - Event: %s (ID: %u)\n", 
+            ctime(&timestamp), goon_event_get_name(event), event->id);
+    
+    return GOON_SUCCESS;
+}
+
+int goon_handler_counter(goon_context_t *ctx, goon_event_t *event, void *user_data) {
+    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+    
+    int *counter = (int*)user_data;
+    if (counter) {
+        (*counter)++;
+        printf("[COUNTER] Event count: %d\n", *counter);
+    }
+    
+    return GOON_SUCCESS;
+}
+
+int goon_handler_cache_writer(goon_context_t *ctx, goon_event_t *event, void *user_data) {
+    if (!ctx || !event || !ctx->cache) return GOON_ERROR_NULL_PTR;
+    
+    if (event->data && event->data->value) {
+        int result = goon_cache_set(ctx->cache, goon_event_get_name(event), 
+                                     event->data->value, event->data->size);
+        
+        if (result == GOON_SUCCESS) {
+            GOON_DEBUG("Cached event data for '%s'", goon_event_get_name(event));
+        }
+    }
+    
+    return GOON_SUCCESS;
+}
+
+int goon_handler_validator(goon_context_t *ctx, goon_event_t *event, void *user_data) {
+    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+    
+    if (strlen(goon_event_get_name(event)) == 0) {
+        GOON_ERROR_LOG("Event has empty name");
+        return GOON_DROP;
+    }
+    
+    if (event->priority > GOON_PRIORITY_CRITICAL) {
+        GOON_ERROR_LOG("Event has invalid priority");
+        return GOON_DROP;
+    }
+    
+    return GOON_SUCCESS;
+}
+
+int goon_handler_filter(goon_context_t *ctx, goon_event_t *event, void *user_data) {
+    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+    
+    const char *filter_prefix = (const char*)user_data;
+    if (!filter_prefix) return GOON_SUCCESS;
+    
+    if (strncmp(goon_event_get_name(event), filter_prefix, strlen(filter_prefix)) == 0) {
+        GOON_DEBUG("Event '%s' passed filter", goon_event_get_name(event));
+        return GOON_SUCCESS;
+    }
+    
+    GOON_DEBUG("Event '%s' filtered out", goon_event_get_name(event));
+    return GOON_STOP_CHAIN;
+}
+
+int goon_handler_statistics(goon_context_t *ctx, goon_event_t *event, void *user_data) {
+    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+    
+    static uint64_t event_count_by_priority[4] = {0};
+    
+    if (event->priority <= GOON_PRIORITY_CRITICAL) {
+        event_count_by_priority[event->priority]++;
+    }
+    
+    if (ctx->debug_mode) {
+        printf("[STATS] Priority distribution - Low: %llu, Normal: %llu, High: %llu, Critical: %llu\n",
+               (unsigned long long)event_count_by_priority[0],
+               (unsigned long long)event_count_by_priority[1],
+               (unsigned long long)event_count_by_priority[2],
+               (unsigned long long)event_count_by_priority[3]);
+    }
+    
+    return GOON_SUCCESS;
+}
+
+int goon_handler_transformer(goon_context_t *ctx, goon_event_t *event, void *user_data) {
+    if (!ctx || !event || !event->data) return GOON_ERROR_NULL_PTR;
+    
+    if (event->data->type == GOON_TYPE_STRING && event->data->value) {
+        char *str = (char*)event->data->value;
+        size_t len = strlen(str);
+        
+        for (size_t i = 0; i < len; i++) {
+            if (str[i] >= 'a' && str[i] <= 'z') {
+                str[i] = str[i] - 'a' + 'A';
             }
-            
-            goon_handler_destroy(handler);
-            ctx->handler_count--;
-            GOON_INFO("Unregistered handler '%s'", name);
-            return GOON_SUCCESS;
         }
         
-        prev = handler;
-        handler = handler->next;
+        GOON_DEBUG("Transformed string to uppercase");
     }
     
-    return GOON_ERROR_NOT_FOUND;
+    return GOON_SUCCESS;
 }
 
-int goon_context_set_state(goon_context_t *ctx, goon_state_t state) {
-    if (!ctx) return GOON_ERROR_NULL_PTR;
+int goon_handler_duplicate_detector(goon_context_t *ctx, goon_event_t *event, void *user_data) {
+    if (!ctx || !event || !ctx->cache) return GOON_ERROR_NULL_PTR;
+    
+    char cache_key[GOON_MAX_NAME_LEN + 16];
+    snprintf(cache_key, sizeof(cache_key), "event_%s", goon_event_get_name(event));
+    
+    void *cached = goon_cache_get(ctx->cache, cache_key, NULL);
+    if (cached) {
+        GOON_WARN("Duplicate event detected: %s", goon_event_get_name(event));
+        return GOON_ERROR;
+    }
+    
+    int marker = 1;
+    goon_cache_set(ctx->cache, cache_key, &marker, sizeof(int));
     
-    ctx->state = state;
-    GOON_DEBUG("Context '%s' state changed to %d", ctx->name, state);
     return GOON_SUCCESS;
 }
 
-goon_state_t goon_context_get_state(goon_context_t *ctx) {
-    if (!ctx) return GOON_STATE_ERROR;
-    return ctx->state;
+int goon_handler_rate_limiter(goon_context_t *ctx, goon_event_t *event, void *user_data) {
+    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+    
+    static time_t last_event_time = 0;
+    static int event_count = 0;
+    
+    time_t now = time(NULL);
+    
+    if (now != last_event_time) {
+        event_count = 0;
+        last_event_time = now;
+    }
+    
+    event_count++;
+    
+    int *max_per_second = (int*)user_data;
+    int limit = max_per_second ? *max_per_second : 10;
+    
+    if (event_count > limit) {
+        GOON_WARN("Rate limit exceeded for event '%s'", goon_event_get_name(event));
+        return GOON_ERROR;
+    }
+    
+    return GOON_SUCCESS;
 }
 
 /* ============================================================================
- * EVENT PROCESSING FUNCTIONS
+ * ADVANCED UTILITY FUNCTIONS
  * ============================================================================ */
 
-int goon_context_emit_event(goon_context_t *ctx, goon_event_t *event) {
-    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+int goon_context_enable_debug(goon_context_t *ctx) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    ctx->debug_mode = true;
+    GOON_INFO("Debug mode enabled");
+    return GOON_SUCCESS;
+}
+
+int goon_context_disable_debug(goon_context_t *ctx) {
+    if (!ctx) return GOON_ERROR_NULL_PTR;
+    ctx->debug_mode = false;
+    GOON_INFO("Debug mode disabled");
+    return GOON_SUCCESS;
+}
+
+int goon_context_clear_queue(goon_context_t *ctx) {
+    if (!ctx || !ctx->event_queue) return GOON_ERROR_NULL_PTR;
     
-    int result = goon_queue_push(ctx->event_queue, event);
-    if (result == GOON_SUCCESS) {
-        ctx->event_count++;
-        GOON_DEBUG("Event '%s' (ID: %u) emitted", event->name, event->id);
+    size_t cleared = 0;
+    while (!goon_queue_is_empty(ctx->event_queue)) {
+        goon_event_t *event = goon_context_next_event(ctx);
+        if (event) {
+            goon_event_destroy(event);
+            cleared++;
+        }
     }
+    goon_context_commit_spill(ctx);
     
-    return result;
+    GOON_INFO("Cleared %zu events from queue", cleared);
+    return GOON_SUCCESS;
 }
 
-int goon_context_process_events(goon_context_t *ctx) {
+int goon_context_reset_statistics(goon_context_t *ctx) {
     if (!ctx) return GOON_ERROR_NULL_PTR;
     
-    if (ctx->state != GOON_STATE_RUNNING) {
-        GOON_WARN("Context is not in RUNNING state");
-        return GOON_ERROR;
+    goon_handler_t *handler = ctx->handlers;
+    while (handler) {
+        handler->call_count = 0;
+        handler->error_count = 0;
+        handler->drop_count = 0;
+        goon_histogram_t *hist = atomic_load(&handler->latency);
+        if (hist) goon_histogram_reset(hist);
+        handler = handler->next;
     }
     
-    int processed = 0;
+    ctx->total_events_processed = 0;
+    ctx->start_time = time(NULL);
     
-    while (!goon_queue_is_empty(ctx->event_queue)) {
-        goon_event_t *event = goon_queue_pop(ctx->event_queue);
-        if (!event) break;
+    GOON_INFO("Statistics reset for context '%s'", ctx->name);
+    return GOON_SUCCESS;
+}
+
+/* ============================================================================
+ * SERIALIZATION FUNCTIONS
+ * ============================================================================ */
+
+int goon_event_serialize(goon_event_t *event, char *buffer, size_t buffer_size) {
+    if (!event || !buffer || buffer_size == 0) return GOON_ERROR_NULL_PTR;
+    
+    int written = snprintf(buffer, buffer_size,
+                          "EVENT{id:%u,name:%s,priority:%d,timestamp:%ld}",
+                          event->id, goon_event_get_name(event), goon_event_get_priority(event),
+                          (long)goon_event_get_timestamp(event));
+    
+    if (written < 0 || (size_t)written >= buffer_size) {
+        return GOON_ERROR_OVERFLOW;
+    }
+    
+    return GOON_SUCCESS;
+}
+
+goon_event_t* goon_event_deserialize(const char *buffer) {
+    if (!buffer) return NULL;
+    
+    uint32_t id;
+    char name[GOON_MAX_NAME_LEN];
+    int priority;
+    time_t timestamp;
+    
+    int parsed = sscanf(buffer, "EVENT{id:%u,name:%127[^,],priority:%d,timestamp:%ld}",
+                       &id, name, &priority, &timestamp);
+    
+    if (parsed != 4) {
+        GOON_ERROR_LOG("Failed to parse event from buffer");
+        return NULL;
+    }
+    
+    goon_event_t *event = goon_event_create(name, (goon_priority_t)priority);
+    if (event) {
+        event->id = id;
+        event->timestamp_ns = (uint64_t)timestamp * 1000000000ull;
+    }
+    
+    return event;
+}
+
+/* ============================================================================
+ * BATCH PROCESSING FUNCTIONS
+ * ============================================================================ */
+
+int goon_context_emit_batch(goon_context_t *ctx, goon_event_t **events, size_t count) {
+    if (!ctx || !events) return GOON_ERROR_NULL_PTR;
+    
+    goon_event_t *head = NULL;
+    goon_event_t *tail = NULL;
+    size_t linked = 0;
+    
+    for (size_t i = 0; i < count; i++) {
+        if (!events[i]) continue;
+        
+        events[i]->next = NULL;
+        if (tail) {
+            tail->next = events[i];
+        } else {
+            head = events[i];
+        }
+        tail = events[i];
+        linked++;
+    }
+    
+    if (linked == 0) return 0;
+    
+    // Fast path: the whole chain fits and nothing is spilled ahead of it
+    if (ctx->coalesce_mode == GOON_COALESCE_OFF && !ctx->persistent &&
+        atomic_load_explicit(&ctx->spill_count, memory_order_acquire) == 0 &&
+        goon_queue_push_batch(ctx->event_queue, head, tail, linked) == GOON_SUCCESS) {
+        atomic_fetch_add(&ctx->event_count, linked);
+        goon_context_notify(ctx);
+        if (ctx->debug_mode) {
+            GOON_DEBUG("Emitted batch of %zu events", linked);
+        }
+        return (int)linked;
+    }
+    
+    // Otherwise coalesce and apply the overflow policy event by event
+    int success = 0;
+    goon_event_t *event = head;
+    while (event) {
+        goon_event_t *next = event->next;
+        if (goon_context_emit_event(ctx, event) == GOON_SUCCESS) {
+            success++;
+        }
+        event = next;
+    }
+    
+    if (ctx->debug_mode) {
+        GOON_DEBUG("Emitted %d out of %zu events", success, count);
+    }
+    return success;
+}
+
+int goon_context_register_batch(goon_context_t *ctx, goon_handler_t **handlers, size_t count) {
+    if (!ctx || !handlers) return GOON_ERROR_NULL_PTR;
+    
+    int success = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (handlers[i]) {
+            if (goon_context_register_handler(ctx, handlers[i]) == GOON_SUCCESS) {
+                success++;
+            }
+        }
+    }
+    
+    GOON_INFO("Registered %d out of %zu handlers", success, count);
+    return success;
+}
+
+/* ============================================================================
+ * THREADING AND SYNCHRONIZATION UTILITIES
+ * ============================================================================ */
+
+/*
+ * A worker either runs on the caller's thread, through goon_worker_tick()
+ * or the blocking goon_worker_run(), or, when created with
+ * goon_worker_create_pool(), owns N pthreads. Each
+ * thread keeps a Chase-Lev deque of small event batches: it pops its own
+ * work LIFO and steals FIFO from siblings when idle. Only one thread at a
+ * time drains the context queue (and drives timers), splitting what it
+ * takes into batches on its own deque for the others to steal. Handlers
+ * of a pooled context run concurrently and must be thread-safe; producers
+ * on other threads should use GOON_QUEUE_MODE_RING.
+ */
+
+typedef struct {
+    goon_event_t *events[GOON_WORKER_CHUNK];
+    size_t count;
+    goon_dispatch_plan_t *plan;
+} goon_work_batch_t;
+
+typedef struct {
+    _Alignas(GOON_CACHE_LINE) _Atomic int64_t top;
+    _Alignas(GOON_CACHE_LINE) _Atomic int64_t bottom;
+    _Atomic(goon_work_batch_t*) slots[GOON_WORKER_DEQUE_SIZE];
+} goon_work_deque_t;
+
+typedef struct {
+    uint64_t events;
+    uint64_t batches;
+    uint64_t steals;
+    uint64_t steal_attempts;
+    uint64_t idle_ns;
+    uint64_t tasks;
+} goon_worker_stats_t;
+
+typedef struct goon_worker_thread {
+    goon_work_deque_t deque;
+    struct goon_worker *worker;
+    pthread_t thread;
+    size_t index;
+    uint32_t rng;
+    _Atomic uint64_t events;
+    _Atomic uint64_t batches;
+    _Atomic uint64_t steals;
+    _Atomic uint64_t steal_attempts;
+    _Atomic uint64_t idle_ns;
+    _Atomic uint64_t tasks;
+} goon_worker_thread_t;
+
+typedef struct {
+    _Atomic int fd;
+    goon_fd_func func;
+    void *user_data;
+} goon_fd_watch_t;
+
+typedef struct goon_worker {
+    goon_context_t *ctx;
+    _Atomic bool running;
+    _Atomic uint64_t iterations;
+    size_t thread_count;
+    goon_worker_thread_t *threads;
+    pthread_mutex_t intake_lock;
+    _Atomic size_t in_flight;
+    pthread_mutex_t idle_lock;
+    pthread_cond_t idle_cond;
+    _Atomic uint32_t sleepers;
+    
+    // One idle thread blocks in epoll on the context's wake fd, the next
+    // timer and any ingest fds; the others park on idle_cond
+    int epoll_fd;
+    pthread_mutex_t poll_lock;
+    _Atomic bool run_active;
+    pthread_t run_thread;
+    goon_fd_watch_t watches[GOON_WORKER_MAX_FDS];
+} goon_worker_t;
+
+static __thread goon_worker_thread_t *g_worker_self = NULL;
+
+static bool goon_deque_push(goon_work_deque_t *deque, goon_work_batch_t *batch) {
+    int64_t b = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    int64_t t = atomic_load_explicit(&deque->top, memory_order_acquire);
+    if (b - t >= GOON_WORKER_DEQUE_SIZE) return false;
+    
+    atomic_store_explicit(&deque->slots[b & (GOON_WORKER_DEQUE_SIZE - 1)], batch, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, b + 1, memory_order_release);
+    return true;
+}
+
+static goon_work_batch_t* goon_deque_pop(goon_work_deque_t *deque) {
+    int64_t b = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t t = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    
+    if (t > b) {
+        atomic_store_explicit(&deque->bottom, b + 1, memory_order_relaxed);
+        return NULL;
+    }
+    
+    goon_work_batch_t *batch = atomic_load_explicit(&deque->slots[b & (GOON_WORKER_DEQUE_SIZE - 1)],
+                                                    memory_order_relaxed);
+    if (t == b) {
+        // Last element: race any thief for it
+        if (!atomic_compare_exchange_strong_explicit(&deque->top, &t, t + 1,
+                                                     memory_order_seq_cst, memory_order_relaxed)) {
+            batch = NULL;
+        }
+        atomic_store_explicit(&deque->bottom, b + 1, memory_order_relaxed);
+    }
+    
+    return batch;
+}
+
+static goon_work_batch_t* goon_deque_steal(goon_work_deque_t *deque) {
+    int64_t t = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t b = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    
+    if (t >= b) return NULL;
+    
+    goon_work_batch_t *batch = atomic_load_explicit(&deque->slots[t & (GOON_WORKER_DEQUE_SIZE - 1)],
+                                                    memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &t, t + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed)) {
+        return NULL;
+    }
+    
+    return batch;
+}
+
+static void goon_worker_wake(goon_worker_t *worker) {
+    if (atomic_load_explicit(&worker->sleepers, memory_order_acquire) > 0) {
+        pthread_mutex_lock(&worker->idle_lock);
+        pthread_cond_broadcast(&worker->idle_cond);
+        pthread_mutex_unlock(&worker->idle_lock);
+    }
+}
+
+static void goon_plan_release(goon_dispatch_plan_t *plan) {
+    if (atomic_fetch_sub_explicit(&plan->refs, 1, memory_order_acq_rel) == 1) {
+        pthread_mutex_destroy(&plan->ready_lock);
+        free(plan);
+    }
+}
+
+static void goon_plan_make_ready(goon_dispatch_plan_t *plan, uint32_t step) {
+    pthread_mutex_lock(&plan->ready_lock);
+    plan->ready[plan->ready_count++] = step;
+    pthread_mutex_unlock(&plan->ready_lock);
+    
+    // Advertise the step so an idle sibling can steal a token and help
+    goon_worker_thread_t *self = g_worker_self;
+    if (!self) return;
+    
+    goon_work_batch_t *token = (goon_work_batch_t*)malloc(sizeof(goon_work_batch_t));
+    if (!token) return;
+    
+    token->count = 0;
+    token->plan = plan;
+    atomic_fetch_add_explicit(&plan->refs, 1, memory_order_relaxed);
+    
+    if (goon_deque_push(&self->deque, token)) {
+        goon_worker_wake(self->worker);
+    } else {
+        atomic_fetch_sub_explicit(&plan->refs, 1, memory_order_relaxed);
+        free(token);
+    }
+}
+
+static void goon_plan_help(goon_dispatch_plan_t *plan) {
+    for (;;) {
+        pthread_mutex_lock(&plan->ready_lock);
+        if (plan->ready_count == 0) {
+            pthread_mutex_unlock(&plan->ready_lock);
+            return;
+        }
+        uint32_t index = plan->ready[--plan->ready_count];
+        pthread_mutex_unlock(&plan->ready_lock);
         
-        GOON_DEBUG("Processing event '%s' (ID: %u)", event->name, event->id);
+        goon_dispatch_step_t *step = &plan->steps[index];
+        goon_dispatch_run_step(plan, step);
         
-        goon_handler_t *handler = ctx->handlers;
-        while (handler) {
-            if (handler->enabled) {
-                clock_t start = clock();
-                
-                int result = handler->func(ctx, event, handler->user_data);
-                
-                clock_t end = clock();
-                double exec_time = ((double)(end - start)) / CLOCKS_PER_SEC * 1000.0;
-                
-                handler->call_count++;
-                handler->avg_exec_time = (handler->avg_exec_time * (handler->call_count - 1) + exec_time) / handler->call_count;
-                
-                if (result != GOON_SUCCESS) {
-                    handler->error_count++;
-                    GOON_WARN("Handler '%s' returned error %d", handler->name, result);
-                }
-                
-                if (ctx->debug_mode) {
-                    GOON_DEBUG("Handler '%s' executed in %.3f ms", handler->name, exec_time);
-                }
+        if (g_worker_self) {
+            atomic_fetch_add_explicit(&g_worker_self->tasks, 1, memory_order_relaxed);
+        }
+        
+        for (uint32_t i = 0; i < step->succ_count; i++) {
+            if (atomic_fetch_sub_explicit(&plan->steps[step->succ[i]].pending, 1, memory_order_acq_rel) == 1) {
+                goon_plan_make_ready(plan, step->succ[i]);
             }
-            
-            handler = handler->next;
         }
         
-        goon_event_destroy(event);
-        processed++;
-        ctx->total_events_processed++;
+        atomic_fetch_sub_explicit(&plan->remaining, 1, memory_order_release);
     }
-    
-    return processed;
 }
 
-/* ============================================================================
- * INITIALIZATION AND CLEANUP
- * ============================================================================ */
+static bool goon_steps_conflict(const goon_dispatch_step_t *a, const goon_dispatch_step_t *b) {
+    const goon_handler_t *x = a->entry->handler;
+    const goon_handler_t *y = b->entry->handler;
+    if (goon_handler_depends(y, x)) return true;
+    if (!(a->mask & b->mask)) return false;
+    
+    // Only mutating handlers may return verdicts, so mutation alone orders
+    // overlapping steps, on chain 0 as on any other
+    return x->mutates || y->mutates;
+}
 
-int goon_init(const char *context_name) {
-    if (g_goon_ctx) {
-        GOON_WARN("Goon module already initialized");
-        return GOON_ERROR;
+static bool goon_worker_fanout(goon_context_t *ctx, goon_event_t **events,
+                               goon_dispatch_step_t *steps, size_t step_count) {
+    goon_worker_thread_t *self = g_worker_self;
+    if (!self || self->worker->ctx != ctx || self->worker->thread_count < 2) return false;
+    
+    size_t edges = 0;
+    for (size_t k = 1; k < step_count; k++) {
+        for (size_t j = 0; j < k; j++) {
+            edges += goon_steps_conflict(&steps[j], &steps[k]);
+        }
     }
     
-    g_goon_ctx = goon_context_create(context_name);
-    if (!g_goon_ctx) {
-        GOON_ERROR_LOG("Failed to create goon context");
-        return GOON_ERROR;
+    // Fully serial plans gain nothing from the pool
+    if (edges >= step_count * (step_count - 1) / 2) return false;
+    
+    size_t size = sizeof(goon_dispatch_plan_t) + step_count * sizeof(goon_dispatch_step_t) +
+                  (edges + step_count) * sizeof(uint32_t);
+    goon_dispatch_plan_t *plan = (goon_dispatch_plan_t*)malloc(size);
+    if (!plan) return false;
+    
+    plan->ctx = ctx;
+    plan->events = events;
+    plan->steps = (goon_dispatch_step_t*)(plan + 1);
+    plan->step_count = step_count;
+    plan->ready = (uint32_t*)(plan->steps + step_count);
+    plan->ready_count = 0;
+    pthread_mutex_init(&plan->ready_lock, NULL);
+    atomic_init(&plan->remaining, step_count);
+    atomic_init(&plan->refs, 1);
+    atomic_init(&plan->dropped, 0);
+    atomic_init(&plan->suspended, 0);
+    for (size_t i = 0; i < GOON_DISPATCH_BATCH; i++) {
+        atomic_init(&plan->stopped[i], 0);
     }
     
-    goon_context_set_state(g_goon_ctx, GOON_STATE_INITIALIZING);
-    GOON_INFO("Goon module initialized (version %s)", GOON_VERSION);
+    uint32_t *succ = plan->ready + step_count;
+    for (size_t j = 0; j < step_count; j++) {
+        goon_dispatch_step_t *step = &plan->steps[j];
+        step->entry = steps[j].entry;
+        step->mask = steps[j].mask;
+        step->succ = succ;
+        step->succ_count = 0;
+        atomic_init(&step->pending, 0);
+    }
     
-    return GOON_SUCCESS;
-}
-
-void goon_cleanup(void) {
-    if (!g_goon_ctx) return;
+    for (size_t j = 0; j < step_count; j++) {
+        for (size_t k = j + 1; k < step_count; k++) {
+            if (goon_steps_conflict(&plan->steps[j], &plan->steps[k])) {
+                plan->steps[j].succ[plan->steps[j].succ_count++] = (uint32_t)k;
+                atomic_fetch_add_explicit(&plan->steps[k].pending, 1, memory_order_relaxed);
+            }
+        }
+        if (j + 1 < step_count) {
+            plan->steps[j + 1].succ = plan->steps[j].succ + plan->steps[j].succ_count;
+        }
+    }
     
-    GOON_INFO("Cleaning up goon module");
-    goon_context_destroy(g_goon_ctx);
-    g_goon_ctx = NULL;
-}
-
-goon_context_t* goon_get_context(void) {
-    return g_goon_ctx;
+    for (size_t i = step_count; i-- > 0;) {
+        if (atomic_load_explicit(&plan->steps[i].pending, memory_order_relaxed) == 0) {
+            goon_plan_make_ready(plan, (uint32_t)i);
+        }
+    }
+    
+    // Run ready steps here too; siblings join through the advertised tokens
+    while (atomic_load_explicit(&plan->remaining, memory_order_acquire) > 0) {
+        goon_plan_help(plan);
+        if (atomic_load_explicit(&plan->remaining, memory_order_acquire) > 0) {
+            sched_yield();
+        }
+    }
+    
+    goon_dispatch_settle(plan);
+    goon_plan_release(plan);
+    return true;
 }
 
-/* ============================================================================
- * UTILITY FUNCTIONS
- * ============================================================================ */
-
-void goon_print_stats(goon_context_t *ctx) {
-    if (!ctx) return;
+static void goon_worker_run_batch(goon_worker_t *worker, goon_worker_thread_t *self, goon_work_batch_t *batch) {
+    goon_context_t *ctx = worker->ctx;
     
-    printf("\n=== Goon Context Statistics ===\n");
-    printf("Context Name: %s\n", ctx->name);
-    printf("Context ID: %u\n", ctx->id);
-    printf("State: %d\n", ctx->state);
-    printf("Handlers Registered: %zu\n", ctx->handler_count);
-    printf("Events in Queue: %zu\n", goon_queue_size(ctx->event_queue));
-    printf("Total Events Processed: %llu\n", (unsigned long long)ctx->total_events_processed);
-    printf("Uptime: %ld seconds\n", time(NULL) - ctx->start_time);
-    printf("\n=== Handler Statistics ===\n");
+    if (batch->plan) {
+        goon_plan_help(batch->plan);
+        goon_plan_release(batch->plan);
+        free(batch);
+        return;
+    }
     
-    goon_handler_t *handler = ctx->handlers;
-    while (handler) {
-        printf("\nHandler: %s (ID: %u)\n", handler->name, handler->id);
-        printf("  Enabled: %s\n", handler->enabled ? "Yes" : "No");
-        printf("  Call Count: %llu\n", (unsigned long long)handler->call_count);
-        printf("  Error Count: %llu\n", (unsigned long long)handler->error_count);
-        printf("  Avg Execution Time: %.3f ms\n", handler->avg_exec_time);
-        handler = handler->next;
+    goon_context_dispatch_batch(ctx, batch->events, batch->count);
+    
+    for (size_t i = 0; i < batch->count; i++) {
+        goon_event_destroy(batch->events[i]);
     }
     
-    printf("\n");
-}
-
-int goon_start(goon_context_t *ctx) {
-    if (!ctx) return GOON_ERROR_NULL_PTR;
+    ctx->total_events_processed += batch->count;
+    atomic_fetch_sub_explicit(&worker->in_flight, batch->count, memory_order_release);
     
-    goon_context_set_state(ctx, GOON_STATE_RUNNING);
-    GOON_INFO("Goon context '%s' started", ctx->name);
-    return GOON_SUCCESS;
+    if (self) {
+        atomic_fetch_add_explicit(&self->events, batch->count, memory_order_relaxed);
+        atomic_fetch_add_explicit(&self->batches, 1, memory_order_relaxed);
+    }
+    
+    free(batch);
 }
 
-int goon_stop(goon_context_t *ctx) {
-    if (!ctx) return GOON_ERROR_NULL_PTR;
+static goon_work_batch_t* goon_worker_intake(goon_worker_t *worker, goon_worker_thread_t *self) {
+    goon_context_t *ctx = worker->ctx;
     
-    goon_context_set_state(ctx, GOON_STATE_STOPPING);
-    GOON_INFO("Goon context '%s' stopping", ctx->name);
+    // A single thread drains the context queue; the rest steal from it
+    if (pthread_mutex_trylock(&worker->intake_lock) != 0) return NULL;
     
-    // Process remaining events
-    goon_context_process_events(ctx);
+    goon_context_advance_timers(ctx);
     
-    goon_context_set_state(ctx, GOON_STATE_TERMINATED);
-    return GOON_SUCCESS;
-}
-
-int goon_pause(goon_context_t *ctx) {
-    if (!ctx) return GOON_ERROR_NULL_PTR;
+    // The disk log is only committed once the queue is drained and
+    // everything taken from it so far is dispatched
+    if (atomic_load_explicit(&worker->in_flight, memory_order_acquire) == 0) {
+        goon_context_commit_spill(ctx);
+    }
+    if (atomic_load_explicit(&ctx->spill_count, memory_order_acquire) > 0) {
+        goon_context_unspill(ctx);
+    }
     
-    goon_context_set_state(ctx, GOON_STATE_PAUSED);
-    GOON_INFO("Goon context '%s' paused", ctx->name);
-    return GOON_SUCCESS;
-}
-
-int goon_resume(goon_context_t *ctx) {
-    if (!ctx) return GOON_ERROR_NULL_PTR;
+    goon_event_t *events[GOON_WORKER_INTAKE];
+    size_t count = goon_queue_pop_batch(ctx->event_queue, events, GOON_WORKER_INTAKE);
+    if (count > 0) {
+        atomic_fetch_add_explicit(&worker->in_flight, count, memory_order_relaxed);
+        goon_context_unindex(ctx, events, count);
+        goon_context_release_space(ctx);
+    }
     
-    goon_context_set_state(ctx, GOON_STATE_RUNNING);
-    GOON_INFO("Goon context '%s' resumed", ctx->name);
-    return GOON_SUCCESS;
-}
-
-/* ============================================================================
- * EXAMPLE HANDLER FUNCTIONS
- * ============================================================================ */
-
-int goon_handler_echo(goon_context_t *ctx, goon_event_t *event, void *user_data) {
-    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+    pthread_mutex_unlock(&worker->intake_lock);
     
-    printf("[ECHO HANDLER] Event: %s (ID: %u, Priority: %d)\n", 
-           event->name, event->id, event->priority);
+    if (count == 0) return NULL;
     
-    if (event->data) {
-        goon_data_t *data = event->data;
-        printf("[ECHO HANDLER] Data type: %d, size: %zu\n", data->type, data->size);
+    goon_work_batch_t *first = NULL;
+    size_t shared = 0;
+    
+    for (size_t offset = 0; offset < count; offset += GOON_WORKER_CHUNK) {
+        goon_work_batch_t *batch = (goon_work_batch_t*)malloc(sizeof(goon_work_batch_t));
+        size_t n = count - offset < GOON_WORKER_CHUNK ? count - offset : GOON_WORKER_CHUNK;
         
-        if (data->type == GOON_TYPE_STRING && data->value) {
-            printf("[ECHO HANDLER] String value: %s\n", (char*)data->value);
-        } else if (data->type == GOON_TYPE_INT && data->value) {
-            printf("[ECHO HANDLER] Int value: %d\n", *(int*)data->value);
-        } else if (data->type == GOON_TYPE_FLOAT && data->value) {
-            printf("[ECHO HANDLER] Float value: %f\n", *(float*)data->value);
+        if (!batch) {
+            // Without a batch there is nowhere to park them: dispatch inline
+            goon_context_dispatch_batch(ctx, events + offset, n);
+            for (size_t i = 0; i < n; i++) {
+                goon_event_destroy(events[offset + i]);
+            }
+            ctx->total_events_processed += n;
+            atomic_fetch_sub_explicit(&worker->in_flight, n, memory_order_release);
+            continue;
+        }
+        
+        memcpy(batch->events, events + offset, n * sizeof(goon_event_t*));
+        batch->count = n;
+        batch->plan = NULL;
+        
+        if (!first) {
+            first = batch;
+        } else if (goon_deque_push(&self->deque, batch)) {
+            shared++;
+        } else {
+            goon_worker_run_batch(worker, self, batch);
         }
     }
     
-    return GOON_SUCCESS;
+    if (shared > 0) {
+        goon_worker_wake(worker);
+    }
+    
+    return first;
 }
 
-int goon_handler_logger(goon_context_t *ctx, goon_event_t *event, void *user_data) {
-    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+static goon_work_batch_t* goon_worker_steal(goon_worker_t *worker, goon_worker_thread_t *self) {
+    if (worker->thread_count < 2) return NULL;
     
-    FILE *log_file = (FILE*)user_data;
-    if (!log_file) {
-        log_file = stdout;
+    // xorshift32 picks where to start so thieves spread across victims
+    self->rng ^= self->rng << 13;
+    self->rng ^= self->rng >> 17;
+    self->rng ^= self->rng << 5;
+    size_t start = self->rng % worker->thread_count;
+    
+    for (size_t i = 0; i < worker->thread_count; i++) {
+        goon_worker_thread_t *victim = &worker->threads[(start + i) % worker->thread_count];
+        if (victim == self) continue;
+        
+        atomic_fetch_add_explicit(&self->steal_attempts, 1, memory_order_relaxed);
+        goon_work_batch_t *batch = goon_deque_steal(&victim->deque);
+        if (batch) {
+            atomic_fetch_add_explicit(&self->steals, 1, memory_order_relaxed);
+            return batch;
+        }
     }
     
-    fprintf(log_file, "[LOG] %s - Event: %s (ID: %u)\n", 
-            ctime(&event->timestamp), event->name, event->id);
+    return NULL;
+}
+
+static bool goon_worker_has_work(goon_worker_t *worker) {
+    goon_context_t *ctx = worker->ctx;
+    if (atomic_load_explicit(&ctx->async_ready, memory_order_acquire) > 0) return true;
+    if (ctx->state != GOON_STATE_RUNNING) return false;
+    return !goon_queue_is_empty(ctx->event_queue) ||
+           atomic_load_explicit(&ctx->spill_count, memory_order_acquire) > 0;
+}
+
+static int goon_worker_timeout_ms(goon_worker_t *worker, int cap_ms) {
+    uint64_t next = goon_timer_wheel_next_expiry(worker->ctx->timers);
+    if (next == UINT64_MAX) return cap_ms;
     
-    return GOON_SUCCESS;
+    uint64_t now = goon_time_now_ms();
+    if (next <= now) return 0;
+    if (cap_ms >= 0 && next - now > (uint64_t)cap_ms) return cap_ms;
+    return next - now > INT32_MAX ? INT32_MAX : (int)(next - now);
 }
 
-int goon_handler_counter(goon_context_t *ctx, goon_event_t *event, void *user_data) {
-    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+/*
+ * Block until the context has work, a timer is due or an ingest fd is
+ * ready, running ready fd callbacks. Clearing wake_pending before the
+ * final work check means an emit racing with us always writes the fd.
+ */
+static void goon_worker_wait(goon_worker_t *worker) {
+    goon_context_t *ctx = worker->ctx;
     
-    int *counter = (int*)user_data;
-    if (counter) {
-        (*counter)++;
-        printf("[COUNTER] Event count: %d\n", *counter);
-    }
+    atomic_store(&ctx->wake_pending, false);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!atomic_load(&worker->running) || goon_worker_has_work(worker)) return;
     
-    return GOON_SUCCESS;
+    struct epoll_event ready[GOON_WORKER_POLL_EVENTS];
+    int count = epoll_wait(worker->epoll_fd, ready, GOON_WORKER_POLL_EVENTS, goon_worker_timeout_ms(worker, -1));
+    
+    for (int i = 0; i < count; i++) {
+        if (ready[i].data.ptr == NULL) {
+            uint64_t value;
+            if (read(ctx->wake_fd, &value, sizeof(value)) < 0 && errno != EAGAIN) {
+                GOON_WARN("Failed to drain wake fd: %s", strerror(errno));
+            }
+            continue;
+        }
+        
+        // Callbacks may remove watches, so re-check the slot is still live
+        goon_fd_watch_t *watch = (goon_fd_watch_t*)ready[i].data.ptr;
+        int fd = atomic_load(&watch->fd);
+        if (fd >= 0) {
+            watch->func(ctx, fd, ready[i].events, watch->user_data);
+        }
+    }
 }
 
-int goon_handler_cache_writer(goon_context_t *ctx, goon_event_t *event, void *user_data) {
-    if (!ctx || !event || !ctx->cache) return GOON_ERROR_NULL_PTR;
+static void goon_worker_idle(goon_worker_t *worker, goon_worker_thread_t *self) {
+    uint64_t begin = goon_monotonic_ns();
     
-    if (event->data && event->data->value) {
-        int result = goon_cache_set(ctx->cache, event->name, 
-                                     event->data->value, event->data->size);
+    if (worker->epoll_fd >= 0 && pthread_mutex_trylock(&worker->poll_lock) == 0) {
+        goon_worker_wait(worker);
+        pthread_mutex_unlock(&worker->poll_lock);
+    } else {
+        // The poller shares what it takes through goon_worker_wake(); the
+        // timeout only bounds a wake-up lost to a racing push
+        int park_ms = worker->epoll_fd >= 0 ? GOON_WORKER_PARK_MS : goon_worker_timeout_ms(worker, 1);
+        struct timespec deadline;
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += park_ms / 1000;
+        deadline.tv_nsec += (long)(park_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
         
-        if (result == GOON_SUCCESS) {
-            GOON_DEBUG("Cached event data for '%s'", event->name);
+        pthread_mutex_lock(&worker->idle_lock);
+        atomic_fetch_add(&worker->sleepers, 1);
+        if (atomic_load(&worker->running)) {
+            pthread_cond_timedwait(&worker->idle_cond, &worker->idle_lock, &deadline);
         }
+        atomic_fetch_sub(&worker->sleepers, 1);
+        pthread_mutex_unlock(&worker->idle_lock);
     }
     
-    return GOON_SUCCESS;
+    atomic_fetch_add_explicit(&self->idle_ns, goon_monotonic_ns() - begin, memory_order_relaxed);
 }
 
-int goon_handler_validator(goon_context_t *ctx, goon_event_t *event, void *user_data) {
-    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
-    
-    if (strlen(event->name) == 0) {
-        GOON_ERROR_LOG("Event has empty name");
-        return GOON_ERROR_INVALID_PARAM;
-    }
+static void* goon_worker_thread_main(void *arg) {
+    goon_worker_thread_t *self = (goon_worker_thread_t*)arg;
+    goon_worker_t *worker = self->worker;
     
-    if (event->priority < GOON_PRIORITY_LOW || event->priority > GOON_PRIORITY_CRITICAL) {
-        GOON_ERROR_LOG("Event has invalid priority");
-        return GOON_ERROR_INVALID_PARAM;
+    g_worker_self = self;    
+    while (atomic_load_explicit(&worker->running, memory_order_acquire)) {
+        goon_work_batch_t *batch = goon_deque_pop(&self->deque);
+        
+        // Resumed handlers go ahead of new intake so they cannot starve
+        if (!batch && goon_context_run_continuations(worker->ctx) > 0) continue;
+        
+        if (!batch) batch = goon_worker_intake(worker, self);
+        if (!batch) batch = goon_worker_steal(worker, self);
+        
+        if (batch) {
+            goon_worker_run_batch(worker, self, batch);
+        } else {
+            goon_worker_idle(worker, self);
+        }
     }
     
-    return GOON_SUCCESS;
+    return NULL;
 }
 
-int goon_handler_filter(goon_context_t *ctx, goon_event_t *event, void *user_data) {
-    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
-    
-    const char *filter_prefix = (const char*)user_data;
-    if (!filter_prefix) return GOON_SUCCESS;
+goon_worker_t* goon_worker_create_pool(goon_context_t *ctx, size_t thread_count) {
+    if (!ctx) return NULL;
     
-    if (strncmp(event->name, filter_prefix, strlen(filter_prefix)) == 0) {
-        GOON_DEBUG("Event '%s' passed filter", event->name);
-        return GOON_SUCCESS;
+    goon_worker_t *worker = (goon_worker_t*)calloc(1, sizeof(goon_worker_t));
+    if (!worker) {
+        GOON_ERROR_LOG("Failed to allocate worker");
+        return NULL;
     }
     
-    GOON_DEBUG("Event '%s' filtered out", event->name);
-    return GOON_ERROR;
-}
-
-int goon_handler_statistics(goon_context_t *ctx, goon_event_t *event, void *user_data) {
-    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+    if (thread_count > 0) {
+        worker->threads = (goon_worker_thread_t*)aligned_alloc(GOON_CACHE_LINE,
+            ((thread_count * sizeof(goon_worker_thread_t) + GOON_CACHE_LINE - 1) / GOON_CACHE_LINE) * GOON_CACHE_LINE);
+        if (!worker->threads) {
+            GOON_ERROR_LOG("Failed to allocate worker threads");
+            free(worker);
+            return NULL;
+        }
+        memset(worker->threads, 0, thread_count * sizeof(goon_worker_thread_t));
+    }
     
-    static uint64_t event_count_by_priority[4] = {0};
+    worker->ctx = ctx;
+    atomic_init(&worker->running, false);
+    atomic_init(&worker->iterations, 0);
+    atomic_init(&worker->run_active, false);
+    worker->thread_count = thread_count;
+    atomic_init(&worker->in_flight, 0);
+    atomic_init(&worker->sleepers, 0);
+    pthread_mutex_init(&worker->intake_lock, NULL);
+    pthread_mutex_init(&worker->poll_lock, NULL);
+    
+    for (size_t i = 0; i < GOON_WORKER_MAX_FDS; i++) {
+        atomic_init(&worker->watches[i].fd, -1);
+    }
     
-    if (event->priority >= GOON_PRIORITY_LOW && event->priority <= GOON_PRIORITY_CRITICAL) {
-        event_count_by_priority[event->priority]++;
+    worker->epoll_fd = ctx->wake_fd >= 0 ? epoll_create1(EPOLL_CLOEXEC) : -1;
+    if (worker->epoll_fd >= 0) {
+        struct epoll_event ev = { .events = EPOLLIN, .data.ptr = NULL };
+        if (epoll_ctl(worker->epoll_fd, EPOLL_CTL_ADD, ctx->wake_fd, &ev) != 0) {
+            close(worker->epoll_fd);
+            worker->epoll_fd = -1;
+        }
+    }
+    if (worker->epoll_fd < 0) {
+        GOON_WARN("Worker for context '%s' cannot block in epoll, idle threads will poll", ctx->name);
     }
     
-    if (ctx->debug_mode) {
-        printf("[STATS] Priority distribution - Low: %llu, Normal: %llu, High: %llu, Critical: %llu\n",
-               (unsigned long long)event_count_by_priority[0],
-               (unsigned long long)event_count_by_priority[1],
-               (unsigned long long)event_count_by_priority[2],
-               (unsigned long long)event_count_by_priority[3]);
+    pthread_condattr_t cond_attr;
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&worker->idle_lock, NULL);
+    pthread_cond_init(&worker->idle_cond, &cond_attr);
+    pthread_condattr_destroy(&cond_attr);
+    
+    for (size_t i = 0; i < thread_count; i++) {
+        worker->threads[i].worker = worker;
+        worker->threads[i].index = i;
+        worker->threads[i].rng = (uint32_t)(i * 2654435761u) | 1u;
     }
     
-    return GOON_SUCCESS;
+    return worker;
 }
 
-int goon_handler_transformer(goon_context_t *ctx, goon_event_t *event, void *user_data) {
-    if (!ctx || !event || !event->data) return GOON_ERROR_NULL_PTR;
+goon_worker_t* goon_worker_create(goon_context_t *ctx) {
+    return goon_worker_create_pool(ctx, 0);
+}
+
+int goon_worker_stop(goon_worker_t *worker);
+
+void goon_worker_destroy(goon_worker_t *worker) {
+    if (!worker) return;
     
-    if (event->data->type == GOON_TYPE_STRING && event->data->value) {
-        char *str = (char*)event->data->value;
-        size_t len = strlen(str);
-        
-        for (size_t i = 0; i < len; i++) {
-            if (str[i] >= 'a' && str[i] <= 'z') {
-                str[i] = str[i] - 'a' + 'A';
-            }
-        }
-        
-        GOON_DEBUG("Transformed string to uppercase");
+    if (atomic_load(&worker->running)) {
+        goon_worker_stop(worker);
     }
     
-    return GOON_SUCCESS;
+    if (worker->epoll_fd >= 0) {
+        close(worker->epoll_fd);
+    }
+    
+    pthread_mutex_destroy(&worker->intake_lock);
+    pthread_mutex_destroy(&worker->poll_lock);
+    pthread_cond_destroy(&worker->idle_cond);
+    pthread_mutex_destroy(&worker->idle_lock);
+    free(worker->threads);
+    free(worker);
 }
 
-int goon_handler_duplicate_detector(goon_context_t *ctx, goon_event_t *event, void *user_data) {
-    if (!ctx || !event || !ctx->cache) return GOON_ERROR_NULL_PTR;
+int goon_worker_start(goon_worker_t *worker) {
+    if (!worker) return GOON_ERROR_NULL_PTR;
+    if (atomic_load(&worker->running)) return GOON_ERROR;
     
-    char cache_key[GOON_MAX_NAME_LEN + 16];
-    snprintf(cache_key, sizeof(cache_key), "event_%s", event->name);
+    atomic_store(&worker->running, true);
+    goon_start(worker->ctx);
     
-    void *cached = goon_cache_get(ctx->cache, cache_key, NULL);
-    if (cached) {
-        GOON_WARN("Duplicate event detected: %s", event->name);
-        return GOON_ERROR;
+    for (size_t i = 0; i < worker->thread_count; i++) {
+        if (pthread_create(&worker->threads[i].thread, NULL, goon_worker_thread_main, &worker->threads[i]) != 0) {
+            GOON_ERROR_LOG("Failed to spawn worker thread %zu", i);
+            worker->thread_count = i;
+            goon_worker_stop(worker);
+            return GOON_ERROR;
+        }
     }
     
-    int marker = 1;
-    goon_cache_set(ctx->cache, cache_key, &marker, sizeof(int));
-    
+    GOON_INFO("Worker started for context '%s' with %zu threads", worker->ctx->name, worker->thread_count);
     return GOON_SUCCESS;
 }
-
-int goon_handler_rate_limiter(goon_context_t *ctx, goon_event_t *event, void *user_data) {
-    if (!ctx || !event) return GOON_ERROR_NULL_PTR;
+
+int goon_worker_stop(goon_worker_t *worker) {
+    if (!worker) return GOON_ERROR_NULL_PTR;
     
-    static time_t last_event_time = 0;
-    static int event_count = 0;
+    atomic_store(&worker->running, false);
     
-    time_t now = time(NULL);
+    pthread_mutex_lock(&worker->idle_lock);
+    pthread_cond_broadcast(&worker->idle_cond);
+    pthread_mutex_unlock(&worker->idle_lock);
     
-    if (now != last_event_time) {
-        event_count = 0;
-        last_event_time = now;
+    // Kick the poller even if a wake is already pending
+    if (worker->ctx->wake_fd >= 0) {
+        atomic_store(&worker->ctx->wake_pending, true);
+        uint64_t one = 1;
+        if (write(worker->ctx->wake_fd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+            GOON_WARN("Failed to wake worker: %s", strerror(errno));
+        }
     }
     
-    event_count++;
+    for (size_t i = 0; i < worker->thread_count; i++) {
+        pthread_join(worker->threads[i].thread, NULL);
+    }
     
-    int *max_per_second = (int*)user_data;
-    int limit = max_per_second ? *max_per_second : 10;
+    // Let a goon_worker_run loop on another thread finish its iteration first
+    while (atomic_load(&worker->run_active) && !pthread_equal(worker->run_thread, pthread_self())) {
+        sched_yield();
+    }
     
-    if (event_count > limit) {
-        GOON_WARN("Rate limit exceeded for event '%s'", event->name);
-        return GOON_ERROR;
+    // Batches still parked on deques were already taken off the queue
+    for (size_t i = 0; i < worker->thread_count; i++) {
+        goon_work_batch_t *batch;
+        while ((batch = goon_deque_pop(&worker->threads[i].deque)) != NULL) {
+            goon_worker_run_batch(worker, &worker->threads[i], batch);
+        }
     }
+    goon_context_run_continuations(worker->ctx);
+    goon_context_commit_spill(worker->ctx);
+    
+    goon_stop(worker->ctx);
     
+    GOON_INFO("Worker stopped after %llu iterations", 
+              (unsigned long long)atomic_load(&worker->iterations));
     return GOON_SUCCESS;
 }
 
-/* ============================================================================
- * ADVANCED UTILITY FUNCTIONS
- * ============================================================================ */
-
-int goon_context_enable_debug(goon_context_t *ctx) {
-    if (!ctx) return GOON_ERROR_NULL_PTR;
-    ctx->debug_mode = true;
-    GOON_INFO("Debug mode enabled");
-    return GOON_SUCCESS;
+int goon_worker_tick(goon_worker_t *worker) {
+    if (!worker || !atomic_load(&worker->running)) return GOON_ERROR;
+    
+    // Pooled workers drive themselves
+    if (worker->thread_count > 0) return GOON_ERROR;
+    
+    goon_context_advance_timers(worker->ctx);
+    int processed = goon_context_process_events(worker->ctx);
+    atomic_fetch_add_explicit(&worker->iterations, 1, memory_order_relaxed);
+    
+    return processed;
 }
 
-int goon_context_disable_debug(goon_context_t *ctx) {
-    if (!ctx) return GOON_ERROR_NULL_PTR;
-    ctx->debug_mode = false;
-    GOON_INFO("Debug mode disabled");
+/*
+ * Drive a single-threaded worker from the calling thread until
+ * goon_worker_stop(), sleeping in epoll whenever there is nothing to do.
+ * Emits, due timers, resumed async handlers and ready ingest fds wake it;
+ * emitting from other threads needs GOON_QUEUE_MODE_RING, as the list
+ * and segmented queues are not thread-safe.
+ */
+int goon_worker_run(goon_worker_t *worker) {
+    if (!worker) return GOON_ERROR_NULL_PTR;
+    if (!atomic_load(&worker->running) || worker->thread_count > 0) return GOON_ERROR;
+    
+    worker->run_thread = pthread_self();
+    atomic_store(&worker->run_active, true);
+    
+    while (atomic_load(&worker->running)) {
+        goon_context_advance_timers(worker->ctx);
+        if (worker->ctx->state == GOON_STATE_RUNNING) {
+            goon_context_process_events(worker->ctx);
+        } else {
+            goon_context_run_continuations(worker->ctx);
+        }
+        atomic_fetch_add_explicit(&worker->iterations, 1, memory_order_relaxed);
+        
+        if (worker->epoll_fd >= 0) {
+            goon_worker_wait(worker);
+        } else {
+            usleep(1000);
+        }
+    }
+    
+    atomic_store(&worker->run_active, false);
     return GOON_SUCCESS;
 }
 
-int goon_context_clear_queue(goon_context_t *ctx) {
-    if (!ctx || !ctx->event_queue) return GOON_ERROR_NULL_PTR;
+/*
+ * Watch `fd` for `events` (EPOLLIN, ...) and call `func` on the polling
+ * thread when it is ready, typically to read input and emit events.
+ */
+int goon_worker_add_fd(goon_worker_t *worker, int fd, uint32_t events, goon_fd_func func, void *user_data) {
+    if (!worker || !func) return GOON_ERROR_NULL_PTR;
+    if (fd < 0) return GOON_ERROR_INVALID_PARAM;
+    if (worker->epoll_fd < 0) return GOON_ERROR;
     
-    size_t cleared = 0;
-    while (!goon_queue_is_empty(ctx->event_queue)) {
-        goon_event_t *event = goon_queue_pop(ctx->event_queue);
-        if (event) {
-            goon_event_destroy(event);
-            cleared++;
+    for (size_t i = 0; i < GOON_WORKER_MAX_FDS; i++) {
+        if (atomic_load(&worker->watches[i].fd) >= 0) continue;
+        
+        worker->watches[i].func = func;
+        worker->watches[i].user_data = user_data;
+        
+        struct epoll_event ev = { .events = events, .data.ptr = &worker->watches[i] };
+        if (epoll_ctl(worker->epoll_fd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+            GOON_ERROR_LOG("Failed to watch fd %d: %s", fd, strerror(errno));
+            return GOON_ERROR;
         }
+        
+        atomic_store(&worker->watches[i].fd, fd);
+        return GOON_SUCCESS;
     }
     
-    GOON_INFO("Cleared %zu events from queue", cleared);
-    return GOON_SUCCESS;
+    return GOON_ERROR_OVERFLOW;
 }
 
-int goon_context_reset_statistics(goon_context_t *ctx) {
-    if (!ctx) return GOON_ERROR_NULL_PTR;
+int goon_worker_remove_fd(goon_worker_t *worker, int fd) {
+    if (!worker) return GOON_ERROR_NULL_PTR;
     
-    goon_handler_t *handler = ctx->handlers;
-    while (handler) {
-        handler->call_count = 0;
-        handler->error_count = 0;
-        handler->avg_exec_time = 0.0;
-        handler = handler->next;
+    for (size_t i = 0; i < GOON_WORKER_MAX_FDS; i++) {
+        if (fd >= 0 && atomic_load(&worker->watches[i].fd) == fd) {
+            epoll_ctl(worker->epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+            atomic_store(&worker->watches[i].fd, -1);
+            return GOON_SUCCESS;
+        }
     }
     
-    ctx->total_events_processed = 0;
-    ctx->start_time = time(NULL);
+    return GOON_ERROR_NOT_FOUND;
+}
+
+int goon_worker_get_thread_stats(goon_worker_t *worker, size_t index, goon_worker_stats_t *stats) {
+    if (!worker || !stats) return GOON_ERROR_NULL_PTR;
+    if (index >= worker->thread_count) return GOON_ERROR_INVALID_PARAM;
+    
+    goon_worker_thread_t *thread = &worker->threads[index];
+    stats->events = atomic_load(&thread->events);
+    stats->batches = atomic_load(&thread->batches);
+    stats->steals = atomic_load(&thread->steals);
+    stats->steal_attempts = atomic_load(&thread->steal_attempts);
+    stats->idle_ns = atomic_load(&thread->idle_ns);
+    stats->tasks = atomic_load(&thread->tasks);
     
-    GOON_INFO("Statistics reset for context '%s'", ctx->name);
     return GOON_SUCCESS;
 }
 
-/* ============================================================================
- * SERIALIZATION FUNCTIONS
- * ============================================================================ */
-
-int goon_event_serialize(goon_event_t *event, char *buffer, size_t buffer_size) {
-    if (!event || !buffer || buffer_size == 0) return GOON_ERROR_NULL_PTR;
+void goon_worker_print_stats(goon_worker_t *worker) {
+    if (!worker) return;
     
-    int written = snprintf(buffer, buffer_size,
-                          "EVENT{id:%u,name:%s,priority:%d,timestamp:%ld}",
-                          event->id, event->name, event->priority, event->timestamp);
+    printf("\n=== Worker Statistics ===\n");
+    printf("Context: %s, Threads: %zu\n", worker->ctx->name, worker->thread_count);
     
-    if (written < 0 || (size_t)written >= buffer_size) {
-        return GOON_ERROR_OVERFLOW;
+    for (size_t i = 0; i < worker->thread_count; i++) {
+        goon_worker_stats_t stats;
+        goon_worker_get_thread_stats(worker, i, &stats);
+        printf("Thread %zu: events %llu, batches %llu, handler tasks %llu, steals %llu/%llu, idle %.1f ms\n", i,
+               (unsigned long long)stats.events, (unsigned long long)stats.batches,
+               (unsigned long long)stats.tasks, (unsigned long long)stats.steals,
+               (unsigned long long)stats.steal_attempts, stats.idle_ns / 1e6);
     }
-    
-    return GOON_SUCCESS;
 }
 
-goon_event_t* goon_event_deserialize(const char *buffer) {
-    if (!buffer) return NULL;
-    
-    uint32_t id;
+/* ============================================================================
+ * SHARDED CONTEXTS
+ * ============================================================================ */
+
+/*
+ * A shard set spreads events over N independent contexts by hashing the
+ * event name, or a caller-supplied key, so events sharing a key always
+ * land on the same shard and keep their relative order. Each shard has
+ * its own queue and a single-threaded worker blocking in goon_worker_run()
+ * on a dedicated, optionally CPU-pinned thread. Handlers registered on the
+ * set are instantiated once per shard and only ever see their shard's
+ * events, so per-key handler state needs no locking.
+ */
+
+typedef struct {
+    goon_context_t *ctx;
+    goon_worker_t *worker;
+    pthread_t thread;
+    bool started;
+} goon_shard_t;
+
+typedef struct goon_shard_set {
     char name[GOON_MAX_NAME_LEN];
-    int priority;
-    time_t timestamp;
-    
-    int parsed = sscanf(buffer, "EVENT{id:%u,name:%127[^,],priority:%d,timestamp:%ld}",
-                       &id, name, &priority, &timestamp);
+    goon_shard_t *shards;
+    size_t count;
+    bool running;
+} goon_shard_set_t;
+
+typedef struct {
+    size_t shards;
+    uint64_t emitted;
+    uint64_t processed;
+    uint64_t coalesced;
+    size_t queued;
+    size_t queued_max;
+    size_t suspended;
+    goon_backpressure_stats_t backpressure;
+} goon_shard_stats_t;
+
+void goon_shard_set_destroy(goon_shard_set_t *set);
+
+// shard_count 0 means one shard per online CPU
+goon_shard_set_t* goon_shard_set_create(const char *name, size_t shard_count) {
+    if (shard_count == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        shard_count = cpus > 0 ? (size_t)cpus : 1;
+    }
     
-    if (parsed != 4) {
-        GOON_ERROR_LOG("Failed to parse event from buffer");
+    goon_shard_set_t *set = (goon_shard_set_t*)calloc(1, sizeof(goon_shard_set_t));
+    if (!set) {
+        GOON_ERROR_LOG("Failed to allocate memory for goon_shard_set_t");
         return NULL;
     }
     
-    goon_event_t *event = goon_event_create(name, (goon_priority_t)priority);
-    if (event) {
-        event->id = id;
-        event->timestamp = timestamp;
+    set->shards = (goon_shard_t*)calloc(shard_count, sizeof(goon_shard_t));
+    if (!set->shards) {
+        GOON_ERROR_LOG("Failed to allocate memory for %zu shards", shard_count);
+        free(set);
+        return NULL;
     }
     
-    return event;
-}
-
-/* ============================================================================
- * BATCH PROCESSING FUNCTIONS
- * ============================================================================ */
-
-int goon_context_emit_batch(goon_context_t *ctx, goon_event_t **events, size_t count) {
-    if (!ctx || !events) return GOON_ERROR_NULL_PTR;
+    strncpy(set->name, name ? name : "shards", GOON_MAX_NAME_LEN - 1);
+    set->name[GOON_MAX_NAME_LEN - 1] = '\0';
+    set->count = shard_count;
     
-    int success = 0;
-    for (size_t i = 0; i < count; i++) {
-        if (events[i]) {
-            if (goon_context_emit_event(ctx, events[i]) == GOON_SUCCESS) {
-                success++;
-            }
+    for (size_t i = 0; i < shard_count; i++) {
+        char shard_name[GOON_MAX_NAME_LEN];
+        snprintf(shard_name, sizeof(shard_name), "%.100s/%zu", set->name, i);
+        
+        goon_shard_t *shard = &set->shards[i];
+        shard->ctx = goon_context_create(shard_name);
+        shard->worker = shard->ctx ? goon_worker_create(shard->ctx) : NULL;
+        
+        // Producers on any thread emit into a shard, so it needs the MPMC ring
+        if (!shard->worker || goon_context_set_queue_mode(shard->ctx, GOON_QUEUE_MODE_RING) != GOON_SUCCESS) {
+            GOON_ERROR_LOG("Failed to initialize shard %zu of '%s'", i, set->name);
+            goon_shard_set_destroy(set);
+            return NULL;
         }
     }
     
-    GOON_INFO("Emitted %d out of %zu events", success, count);
-    return success;
+    return set;
 }
 
-int goon_context_register_batch(goon_context_t *ctx, goon_handler_t **handlers, size_t count) {
-    if (!ctx || !handlers) return GOON_ERROR_NULL_PTR;
+int goon_shard_set_stop(goon_shard_set_t *set);
+
+void goon_shard_set_destroy(goon_shard_set_t *set) {
+    if (!set) return;
     
-    int success = 0;
-    for (size_t i = 0; i < count; i++) {
-        if (handlers[i]) {
-            if (goon_context_register_handler(ctx, handlers[i]) == GOON_SUCCESS) {
-                success++;
-            }
-        }
+    if (set->running) {
+        goon_shard_set_stop(set);
     }
     
-    GOON_INFO("Registered %d out of %zu handlers", success, count);
-    return success;
+    for (size_t i = 0; i < set->count; i++) {
+        goon_worker_destroy(set->shards[i].worker);
+        goon_context_destroy(set->shards[i].ctx);
+    }
+    
+    free(set->shards);
+    free(set);
 }
 
-/* ============================================================================
- * THREADING AND SYNCHRONIZATION UTILITIES
- * ============================================================================ */
+size_t goon_shard_set_count(goon_shard_set_t *set) {
+    return set ? set->count : 0;
+}
 
-typedef struct {
-    goon_context_t *ctx;
-    bool running;
-    uint64_t iterations;
-} goon_worker_t;
+// For per-shard configuration (queue capacity, overflow policy, handler order, ...)
+goon_context_t* goon_shard_set_get_context(goon_shard_set_t *set, size_t index) {
+    if (!set || index >= set->count) return NULL;
+    return set->shards[index].ctx;
+}
 
-goon_worker_t* goon_worker_create(goon_context_t *ctx) {
-    if (!ctx) return NULL;
+size_t goon_shard_set_index(goon_shard_set_t *set, const char *key) {
+    if (!set || !key) return 0;
+    return (size_t)(goon_hash_string(key) % set->count);
+}
+
+/*
+ * Subscribe a handler on every shard. Each shard gets its own handler
+ * instance sharing `user_data`, so shared state behind it must be
+ * thread-safe; state keyed by event key is only touched by one shard.
+ */
+int goon_shard_set_subscribe(goon_shard_set_t *set, const char *name, goon_handler_func func,
+                             void *user_data, const char *pattern) {
+    if (!set || !name || !func) return GOON_ERROR_NULL_PTR;
     
-    goon_worker_t *worker = (goon_worker_t*)malloc(sizeof(goon_worker_t));
-    if (!worker) {
-        GOON_ERROR_LOG("Failed to allocate worker");
-        return NULL;
+    for (size_t i = 0; i < set->count; i++) {
+        goon_handler_t *handler = goon_handler_create(name, func, user_data);
+        if (!handler) return GOON_ERROR_OUT_OF_MEMORY;
+        
+        int result = goon_context_subscribe(set->shards[i].ctx, handler, pattern);
+        if (result != GOON_SUCCESS) {
+            goon_handler_destroy(handler);
+            return result;
+        }
     }
     
-    worker->ctx = ctx;
-    worker->running = false;
-    worker->iterations = 0;
+    return GOON_SUCCESS;
+}
+
+// Route by event name: every event with the same name goes to the same shard
+int goon_shard_set_emit(goon_shard_set_t *set, goon_event_t *event) {
+    if (!set || !event) return GOON_ERROR_NULL_PTR;
     
-    return worker;
+    size_t index = (size_t)(goon_symbol_hash(event->sym) % set->count);
+    return goon_context_emit_event(set->shards[index].ctx, event);
 }
 
-void goon_worker_destroy(goon_worker_t *worker) {
-    if (!worker) return;
-    worker->running = false;
-    free(worker);
+// Route by `key`, which also serves as the coalescing key when the shard coalesces
+int goon_shard_set_emit_keyed(goon_shard_set_t *set, goon_event_t *event, const char *key) {
+    if (!set || !event || !key) return GOON_ERROR_NULL_PTR;
+    
+    size_t index = goon_shard_set_index(set, key);
+    return goon_context_emit_keyed(set->shards[index].ctx, event, key);
 }
 
-int goon_worker_start(goon_worker_t *worker) {
-    if (!worker) return GOON_ERROR_NULL_PTR;
+static void* goon_shard_main(void *arg) {
+    goon_shard_t *shard = (goon_shard_t*)arg;
+    goon_worker_run(shard->worker);
+    return NULL;
+}
+
+// With `pin`, shard i runs on CPU i modulo the online CPU count
+int goon_shard_set_start(goon_shard_set_t *set, bool pin) {
+    if (!set) return GOON_ERROR_NULL_PTR;
+    if (set->running) return GOON_ERROR;
     
-    worker->running = true;
-    goon_start(worker->ctx);
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    set->running = true;
+    
+    for (size_t i = 0; i < set->count; i++) {
+        goon_shard_t *shard = &set->shards[i];
+        
+        if (goon_worker_start(shard->worker) != GOON_SUCCESS ||
+            pthread_create(&shard->thread, NULL, goon_shard_main, shard) != 0) {
+            GOON_ERROR_LOG("Failed to start shard %zu of '%s'", i, set->name);
+            goon_shard_set_stop(set);
+            return GOON_ERROR;
+        }
+        shard->started = true;
+        
+        if (pin && cpus > 0) {
+            cpu_set_t cpu_set;
+            CPU_ZERO(&cpu_set);
+            CPU_SET((int)(i % (size_t)cpus), &cpu_set);
+            if (pthread_setaffinity_np(shard->thread, sizeof(cpu_set), &cpu_set) != 0) {
+                GOON_WARN("Failed to pin shard %zu of '%s' to CPU %zu", i, set->name, i % (size_t)cpus);
+            }
+        }
+    }
     
-    GOON_INFO("Worker started for context '%s'", worker->ctx->name);
+    GOON_INFO("Shard set '%s' started with %zu shards%s", set->name, set->count, pin ? " (pinned)" : "");
     return GOON_SUCCESS;
 }
 
-int goon_worker_stop(goon_worker_t *worker) {
-    if (!worker) return GOON_ERROR_NULL_PTR;
+// Drains what each shard already queued before returning
+int goon_shard_set_stop(goon_shard_set_t *set) {
+    if (!set) return GOON_ERROR_NULL_PTR;
     
-    worker->running = false;
-    goon_stop(worker->ctx);
+    for (size_t i = 0; i < set->count; i++) {
+        goon_shard_t *shard = &set->shards[i];
+        
+        // goon_stop() only runs one more tick, so let the run loop empty the queue
+        while (shard->started && atomic_load(&shard->ctx->state) == GOON_STATE_RUNNING &&
+               goon_queue_size(shard->ctx->event_queue) > 0) {
+            sched_yield();
+        }
+        
+        if (atomic_load(&shard->worker->running)) {
+            goon_worker_stop(shard->worker);
+        }
+        if (shard->started) {
+            pthread_join(shard->thread, NULL);
+            shard->started = false;
+        }
+    }
     
-    GOON_INFO("Worker stopped after %llu iterations", 
-              (unsigned long long)worker->iterations);
+    set->running = false;
     return GOON_SUCCESS;
 }
 
-int goon_worker_tick(goon_worker_t *worker) {
-    if (!worker || !worker->running) return GOON_ERROR;
+int goon_shard_set_get_stats(goon_shard_set_t *set, goon_shard_stats_t *stats) {
+    if (!set || !stats) return GOON_ERROR_NULL_PTR;
     
-    int processed = goon_context_process_events(worker->ctx);
-    worker->iterations++;
+    memset(stats, 0, sizeof(*stats));
+    stats->shards = set->count;
     
-    return processed;
+    for (size_t i = 0; i < set->count; i++) {
+        goon_context_t *ctx = set->shards[i].ctx;
+        size_t queued = goon_queue_size(ctx->event_queue);
+        
+        stats->emitted += atomic_load(&ctx->event_count);
+        stats->processed += atomic_load(&ctx->total_events_processed);
+        stats->coalesced += atomic_load(&ctx->coalesced_count);
+        stats->queued += queued;
+        stats->suspended += atomic_load(&ctx->async_suspended);
+        if (queued > stats->queued_max) stats->queued_max = queued;
+        
+        goon_backpressure_stats_t bp;
+        goon_context_get_backpressure_stats(ctx, &bp);
+        stats->backpressure.rejected += bp.rejected;
+        stats->backpressure.blocked += bp.blocked;
+        stats->backpressure.timed_out += bp.timed_out;
+        stats->backpressure.dropped_oldest += bp.dropped_oldest;
+        stats->backpressure.dropped_lowest += bp.dropped_lowest;
+        stats->backpressure.spilled += bp.spilled;
+        stats->backpressure.unspilled += bp.unspilled;
+        if (bp.spill_high_water > stats->backpressure.spill_high_water) {
+            stats->backpressure.spill_high_water = bp.spill_high_water;
+        }
+    }
+    
+    return GOON_SUCCESS;
+}
+
+void goon_shard_set_print_stats(goon_shard_set_t *set) {
+    if (!set) return;
+    
+    goon_shard_stats_t stats;
+    goon_shard_set_get_stats(set, &stats);
+    
+    printf("\n=== Shard Set Statistics ===\n");
+    printf("Shard Set: %s (%zu shards)%s\n", set->name, stats.shards, set->running ? " [running]" : "");
+    printf("Events Emitted: %llu, Processed: %llu, Coalesced: %llu\n",
+           (unsigned long long)stats.emitted, (unsigned long long)stats.processed,
+           (unsigned long long)stats.coalesced);
+    printf("Events in Queues: %zu (deepest shard: %zu), Suspended: %zu\n",
+           stats.queued, stats.queued_max, stats.suspended);
+    printf("Overflow - Rejected: %llu, Blocked: %llu, Timed Out: %llu, Spilled: %llu\n",
+           (unsigned long long)stats.backpressure.rejected, (unsigned long long)stats.backpressure.blocked,
+           (unsigned long long)stats.backpressure.timed_out, (unsigned long long)stats.backpressure.spilled);
+    
+    for (size_t i = 0; i < set->count; i++) {
+        goon_context_t *ctx = set->shards[i].ctx;
+        printf("Shard %zu: emitted %llu, processed %llu, queued %zu\n", i,
+               (unsigned long long)atomic_load(&ctx->event_count),
+               (unsigned long long)atomic_load(&ctx->total_events_processed),
+               goon_queue_size(ctx->event_queue));
+    }
 }
 
 /* ============================================================================
@@ -1555,6 +8345,89 @@ int goon_config_remove(goon_config_t *config, const char *key) {
  * MAIN FUNCTION - EXAMPLE USAGE
  * ============================================================================ */
 
+static int goon_demo_count(goon_context_t *ctx, goon_event_t *event, void *user_data) {
+    (void)ctx;
+    (void)event;
+    atomic_fetch_add((_Atomic int*)user_data, 1);
+    return GOON_SUCCESS;
+}
+
+static void* goon_demo_run(void *arg) {
+    goon_worker_run((goon_worker_t*)arg);
+    return NULL;
+}
+
+/*
+ * A worker parked in goon_worker_run must wake for a batch emit just as
+ * it does for a single one. Gives up after a second.
+ */
+static int goon_demo_batch_wakeup(void) {
+    _Atomic int seen = 0;
+    goon_context_t *ctx = goon_context_create("batch_context");
+    if (!ctx) return GOON_ERROR;
+    // Emits come from this thread while the worker runs on another
+    goon_context_set_queue_mode(ctx, GOON_QUEUE_MODE_RING);
+    goon_context_register_handler(ctx, goon_handler_create("count", goon_demo_count, (void*)&seen));
+    
+    goon_worker_t *worker = goon_worker_create(ctx);
+    pthread_t thread;
+    if (!worker || goon_worker_start(worker) != GOON_SUCCESS ||
+        pthread_create(&thread, NULL, goon_demo_run, worker) != 0) {
+        goon_worker_destroy(worker);
+        goon_context_destroy(ctx);
+        return GOON_ERROR;
+    }
+    
+    // Let the worker go idle before emitting
+    usleep(50000);
+    
+    goon_event_t *events[8];
+    for (int i = 0; i < 8; i++) {
+        events[i] = goon_context_create_event(ctx, "batch_event", GOON_PRIORITY_NORMAL);
+    }
+    goon_context_emit_batch(ctx, events, 8);
+    
+    for (int waited = 0; waited < 1000 && atomic_load(&seen) < 8; waited++) {
+        usleep(1000);
+    }
+    int result = atomic_load(&seen) == 8 ? GOON_SUCCESS : GOON_ERROR;
+    
+    goon_worker_stop(worker);
+    pthread_join(thread, NULL);
+    goon_worker_destroy(worker);
+    goon_context_destroy(ctx);
+    return result;
+}
+
+/*
+ * Tear down a context while a timer still holds an event with pooled
+ * data. Nothing to check here directly; sanitizer builds catch the pool
+ * being freed before the timer wheel.
+ */
+static int goon_demo_pooled_timer_teardown(void) {
+    goon_context_t *ctx = goon_context_create("timer_context");
+    if (!ctx) return GOON_ERROR;
+    
+    int value = 42;
+    goon_event_t *event = goon_context_create_event(ctx, "late_event", GOON_PRIORITY_NORMAL);
+    goon_data_t *data = goon_context_create_data(ctx, GOON_TYPE_INT, &value, sizeof(value));
+    if (!event || !data) {
+        goon_data_destroy(data);
+        goon_event_destroy(event);
+        goon_context_destroy(ctx);
+        return GOON_ERROR;
+    }
+    goon_event_set_data(event, data);
+    
+    int result = goon_context_emit_after(ctx, event, 60000) != 0 ? GOON_SUCCESS : GOON_ERROR;
+    if (result != GOON_SUCCESS) {
+        goon_event_destroy(event);
+    }
+    
+    goon_context_destroy(ctx);
+    return result;
+}
+
 int main(int argc, char *argv[]) {
     printf("=== Goon Module System v%s ===\n\n", GOON_VERSION);
     
@@ -1592,18 +8465,18 @@ int main(int argc, char *argv[]) {
         char event_name[64];
         snprintf(event_name, sizeof(event_name), "test_event_%d", i);
         
-        goon_event_t *event = goon_event_create(event_name, 
-                                                 i % 4); // Rotate through priorities
+        goon_event_t *event = goon_context_create_event(ctx, event_name,
+                                                        i % 4); // Rotate through priorities
         
         // Add some data to events
         if (i % 2 == 0) {
             int value = i * 100;
-            goon_data_t *data = goon_data_create(GOON_TYPE_INT, &value, sizeof(int));
+            goon_data_t *data = goon_context_create_data(ctx, GOON_TYPE_INT, &value, sizeof(int));
             goon_event_set_data(event, data);
         } else {
             char str_value[64];
             snprintf(str_value, sizeof(str_value), "Event number %d", i);
-            goon_data_t *data = goon_data_create(GOON_TYPE_STRING, str_value, strlen(str_value) + 1);
+            goon_data_t *data = goon_context_create_data(ctx, GOON_TYPE_STRING, str_value, strlen(str_value) + 1);
             goon_event_set_data(event, data);
         }
         
@@ -1620,11 +8493,16 @@ int main(int argc, char *argv[]) {
     // Print statistics
     goon_print_stats(ctx);
     
+    int batch_ok = goon_demo_batch_wakeup();
+    printf("\nBatch wakeup: %s\n", batch_ok == GOON_SUCCESS ? "ok" : "FAILED");
+    int teardown_ok = goon_demo_pooled_timer_teardown();
+    printf("Pooled timer teardown: %s\n", teardown_ok == GOON_SUCCESS ? "ok" : "FAILED");
+    
     // Clean up
     goon_stop(ctx);
     goon_cleanup();
     
     printf("\n=== Goon Module System Terminated ===\n");
     
-    return 0;
+    return batch_ok == GOON_SUCCESS && teardown_ok == GOON_SUCCESS ? 0 : 1;
 }